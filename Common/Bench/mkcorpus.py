@@ -0,0 +1,296 @@
+#!/usr/bin/env python3
+# Copyright (c) 2020 Paul Mattes.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+#     * Redistributions of source code must retain the above copyright
+#       notice, this list of conditions and the following disclaimer.
+#     * Redistributions in binary form must reproduce the above copyright
+#       notice, this list of conditions and the following disclaimer in the
+#       documentation and/or other materials provided with the distribution.
+#     * Neither the name of Paul Mattes nor his contributors may be used
+#       to endorse or promote products derived from this software without
+#       specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR
+# IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+# OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN
+# NO EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+# TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+# PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+# LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+# NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+# SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+# Generates the bench3270 corpus: binary trace files holding the host side
+# of synthetic sessions. The output is deterministic, so the files only need
+# to be regenerated when this script changes.
+#
+# Usage: mkcorpus.py [directory]
+
+import random
+import struct
+import sys
+import os
+
+# Telnet.
+IAC = 255
+SB = 250
+SE = 240
+WILL = 251
+DO = 253
+EOR = 239
+BINARY = 0
+ECHO = 1
+SGA = 3
+TTYPE = 24
+TELOPT_EOR = 25
+TN3270E = 40
+
+# TN3270E.
+TN3270E_OP_CONNECT = 1
+TN3270E_OP_DEVICE_TYPE = 2
+TN3270E_OP_FUNCTIONS = 3
+TN3270E_OP_IS = 4
+TN3270E_OP_SEND = 8
+TN3270E_FUNC_RESPONSES = 2
+
+# 3270.
+CMD_W = 0xf1
+CMD_EW = 0xf5
+CMD_WSF = 0xf3
+ORDER_SF = 0x1d
+ORDER_SFE = 0x29
+ORDER_SA = 0x28
+ORDER_SBA = 0x11
+ORDER_IC = 0x13
+ORDER_RA = 0x3c
+XA_HIGHLIGHTING = 0x41
+XA_FOREGROUND = 0x42
+XA_CHARSET = 0x43
+XA_3270 = 0xc0
+WCC_RESTORE_RESET = 0xc3
+WCC_RESTORE = 0xc2
+EBC_SO = 0x0e
+EBC_SI = 0x0f
+SF_TRANSFER_DATA = 0xd0
+
+# Binary trace format (see include/bintrace.h).
+BT_MAGIC = b'x3270trc'
+BT_VERSION = 1
+BT_NET_IN = 3
+
+CODE_TABLE = [
+    0x40, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+    0xd8, 0xd9, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+    0xe8, 0xe9, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f ]
+
+WORDS = ('ACCOUNT BALANCE CUSTOMER ORDER STATUS PENDING SHIPPED INVOICE '
+         'REGION TOTAL QUANTITY PRICE ITEM DESCRIPTION WAREHOUSE DATE '
+         'ERROR ACTIVE CLOSED NUMBER NAME ADDRESS CITY BRANCH').split()
+
+def varint(n):
+    out = bytearray()
+    while True:
+        b = n & 0x7f
+        n >>= 7
+        if n:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+def write_trace(path, records):
+    with open(path, 'wb') as f:
+        f.write(BT_MAGIC + bytes([BT_VERSION]) + struct.pack('<Q', 0))
+        for r in records:
+            f.write(bytes([BT_NET_IN]) + varint(len(r)) + varint(0) + r)
+
+def ba(addr):
+    return bytes([ORDER_SBA, CODE_TABLE[(addr >> 6) & 0x3f],
+        CODE_TABLE[addr & 0x3f]])
+
+def ebc(s):
+    return s.encode('cp037')
+
+def words(rnd, n):
+    return ' '.join(rnd.choice(WORDS) for _ in range(n))
+
+def telnet_record(data):
+    """Escape a 3270 record and add IAC EOR."""
+    return data.replace(b'\xff', b'\xff\xff') + bytes([IAC, EOR])
+
+def negotiate_tn3270():
+    return bytes([IAC, DO, TTYPE, IAC, SB, TTYPE, 1, IAC, SE,
+        IAC, DO, TELOPT_EOR, IAC, WILL, TELOPT_EOR,
+        IAC, DO, BINARY, IAC, WILL, BINARY])
+
+def negotiate_tn3270e():
+    return (bytes([IAC, DO, TN3270E,
+            IAC, SB, TN3270E, TN3270E_OP_SEND, TN3270E_OP_DEVICE_TYPE,
+            IAC, SE,
+            IAC, SB, TN3270E, TN3270E_OP_DEVICE_TYPE, TN3270E_OP_IS]) +
+        b'IBM-3278-2-E' + bytes([TN3270E_OP_CONNECT]) + b'BENCH001' +
+        bytes([IAC, SE,
+            IAC, SB, TN3270E, TN3270E_OP_FUNCTIONS, TN3270E_OP_IS,
+            TN3270E_FUNC_RESPONSES, IAC, SE]))
+
+def e_header(seq):
+    """TN3270E header: 3270-DATA, no response requested."""
+    return bytes([0, 0, 0, (seq >> 8) & 0xff, seq & 0xff])
+
+def formatted(rnd):
+    """Full-screen formatted panels, TN3270E."""
+    records = [negotiate_tn3270e()]
+    colors = [0xf1, 0xf2, 0xf4, 0xf5, 0xf6, 0xf7]
+    for seq in range(200):
+        r = bytearray([CMD_EW, WCC_RESTORE_RESET])
+        r += ba(0) + bytes([ORDER_SF, 0x60]) + ebc('PANEL%04d' % seq)
+        r += ba(30) + bytes([ORDER_SFE, 2, XA_3270, 0x68,
+            XA_FOREGROUND, 0xf5]) + ebc(words(rnd, 3).ljust(30)[:30])
+        r += ba(80) + bytes([ORDER_RA]) + ba(160)[1:] + ebc('-')
+        for row in range(2, 22):
+            addr = row * 80
+            r += ba(addr) + bytes([ORDER_SFE, 2, XA_3270, 0x60,
+                XA_FOREGROUND, rnd.choice(colors)])
+            r += ebc(rnd.choice(WORDS).ljust(12)[:12] + ':')
+            r += bytes([ORDER_SFE, 2, XA_3270, 0x40,
+                XA_HIGHLIGHTING, 0xf4])
+            r += ebc(words(rnd, 2).ljust(20)[:20])
+            r += bytes([ORDER_SF, 0x60])
+            r += bytes([ORDER_SA, XA_FOREGROUND, rnd.choice(colors)])
+            r += ebc(words(rnd, 4).ljust(40)[:40])
+            r += bytes([ORDER_SA, XA_FOREGROUND, 0])
+        r += ba(22 * 80) + bytes([ORDER_SF, 0x60]) + ebc('COMMAND ===>')
+        r += bytes([ORDER_SF, 0x40, ORDER_IC])
+        r += ba(23 * 80 - 1) + bytes([ORDER_SF, 0x60])
+        r += ba(23 * 80) + bytes([ORDER_SF, 0xe8]) + ebc(
+            'PF1=HELP  PF3=END  PF7=UP  PF8=DOWN')
+        records.append(telnet_record(e_header(seq) + bytes(r)))
+    return records
+
+def sparse(rnd):
+    """Small updates to an existing screen, classic TN3270."""
+    records = [negotiate_tn3270()]
+    r = bytearray([CMD_EW, WCC_RESTORE_RESET])
+    for row in range(24):
+        r += ba(row * 80) + bytes([ORDER_SF, 0x60]) + ebc(
+            words(rnd, 6)[:60])
+    records.append(telnet_record(bytes(r)))
+    for _ in range(2000):
+        r = bytearray([CMD_W, WCC_RESTORE])
+        for _ in range(rnd.randint(1, 4)):
+            r += ba(rnd.randrange(24) * 80 + rnd.randint(1, 40))
+            r += ebc(words(rnd, 2)[:rnd.randint(4, 20)])
+        records.append(telnet_record(bytes(r)))
+    return records
+
+def dbcs(rnd):
+    """Mixed SBCS/DBCS panels, for a DBCS code page such as cp939."""
+    records = [negotiate_tn3270()]
+    for seq in range(300):
+        r = bytearray([CMD_EW, WCC_RESTORE_RESET])
+        for row in range(24):
+            r += ba(row * 80) + bytes([ORDER_SF, 0x60])
+            r += ebc('%02d ' % row)
+            r += bytes([EBC_SO])
+            for _ in range(rnd.randint(8, 30)):
+                # Kanji, and full-width Latin letters.
+                if rnd.random() < 0.8:
+                    r += bytes([rnd.randint(0x45, 0x54),
+                        rnd.randint(0x41, 0xfd)])
+                else:
+                    r += bytes([0x42, rnd.randint(0xc1, 0xc9)])
+            r += bytes([EBC_SI])
+            r += ebc(' ' + rnd.choice(WORDS))
+        r += ba(23 * 80 + 40) + bytes([ORDER_SFE, 2, XA_3270, 0x40,
+            XA_CHARSET, 0xf8, ORDER_IC])
+        records.append(telnet_record(bytes(r)))
+    return records
+
+def nvt(rnd):
+    """A scrolling log, in NVT mode, with ANSI color."""
+    records = [bytes([IAC, WILL, ECHO, IAC, WILL, SGA])]
+    levels = [('INFO', '32'), ('WARN', '33'), ('ERROR', '31'),
+        ('DEBUG', '36')]
+    text = bytearray()
+    for n in range(6000):
+        level, color = rnd.choice(levels)
+        text += ('2020-10-16 %02d:%02d:%02d.%03d \033[%sm%-5s\033[0m '
+            '[worker-%d] %s\r\n' % (n // 3600 % 24, n // 60 % 60, n % 60,
+            n % 1000, color, level, rnd.randint(1, 8),
+            words(rnd, rnd.randint(3, 12)).lower())).encode('ascii')
+    # Arbitrary splits, as a socket would deliver them.
+    while text:
+        n = rnd.randint(200, 1500)
+        records.append(bytes(text[:n]))
+        text = text[n:]
+    return records
+
+def dft_sf(request, body=b''):
+    sf = bytes([SF_TRANSFER_DATA, request >> 8, request & 0xff]) + body
+    return struct.pack('>H', len(sf) + 2) + sf
+
+def dft_open(name):
+    body = bytes([0x01, 0x06, 0x01, 0x01, 0x04, 0x03, 0x0a, 0x0a,
+        0x00, 0x00, 0x00, 0x00, 0x11, 0x01, 0x01, 0x00,
+        0x50, 0x05, 0x52, 0x03, 0xf0, 0x03, 0x09])
+    return dft_sf(0x0012, body + name.ljust(7).encode('ascii'))
+
+def dft_data(data):
+    return dft_sf(0x4704, bytes([0xc0, 0x80, 0x61]) +
+        struct.pack('>H', len(data) + 5) + data)
+
+def dft(rnd):
+    """An IND$FILE GET of a text file, classic TN3270.
+
+    bench3270 starts the transfer once the keyboard is unlocked, so the
+    host records here pick up after the IND$FILE command is entered."""
+    records = [negotiate_tn3270()]
+    r = bytearray([CMD_EW, WCC_RESTORE_RESET])
+    r += ba(0) + bytes([ORDER_SF, 0x60]) + ebc('READY')
+    r += ba(80) + bytes([ORDER_SF, 0x40, ORDER_IC])
+    r += ba(79 + 80 * 3) + bytes([ORDER_SF, 0x60])
+    records.append(telnet_record(bytes(r)))
+    records.append(telnet_record(bytes([CMD_WSF]) + dft_open('FT:DATA')))
+    text = bytearray()
+    for n in range(8000):
+        text += ('%06d %s\r\n' % (n, words(rnd, rnd.randint(2, 10)))).encode(
+            'ascii')
+    while text:
+        chunk = bytes(text[:2000])
+        text = text[2000:]
+        records.append(telnet_record(bytes([CMD_WSF]) +
+            dft_sf(0x4711) + dft_data(chunk)))
+    records.append(telnet_record(bytes([CMD_WSF]) + dft_sf(0x4112)))
+    records.append(telnet_record(bytes([CMD_WSF]) + dft_open('FT:MSG')))
+    records.append(telnet_record(bytes([CMD_WSF]) + dft_sf(0x4711) +
+        dft_data(b'TRANS03 File transfer complete$')))
+    records.append(telnet_record(bytes([CMD_WSF]) + dft_sf(0x4112)))
+    return records
+
+STREAMS = [
+    ('formatted', formatted),
+    ('sparse', sparse),
+    ('dbcs', dbcs),
+    ('nvt', nvt),
+    ('dft', dft),
+]
+
+def main():
+    outdir = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(
+        os.path.abspath(__file__))
+    for name, fn in STREAMS:
+        write_trace(os.path.join(outdir, name + '.trc'),
+            fn(random.Random(name)))
+
+if __name__ == '__main__':
+    main()
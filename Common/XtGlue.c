@@ -54,6 +54,9 @@
 #if defined(SEPARATE_SELECT_H) /*[*/
 # include <sys/select.h>
 #endif /*]*/
+#if defined(HAVE_SYS_EPOLL_H) /*[*/
+# include <sys/epoll.h>
+#endif /*]*/
 
 #define InputReadMask	0x1
 #define InputExceptMask	0x2
@@ -426,82 +429,143 @@ key_to_string(ks_t k)
 
 /* Timeouts. */
 
+/*
+ * Timeouts are kept in a binary min-heap ordered by expiration time, so
+ * adding, removing and expiring a timeout are O(log n). Each timeout records
+ * its heap index, so the ioid_t handle is enough to remove it.
+ *
+ * Expiration times are in microseconds from a monotonic clock, so changes to
+ * the time of day cannot stall or burst timeouts.
+ */
+typedef unsigned long long mtime_t;
+
+typedef struct timeout {
+    mtime_t ts;			/* expiration time */
+    unsigned long long seq;	/* order added, to break ties */
+    size_t ix;			/* index in the heap */
+    tofn_t proc;
+    bool in_play;
+} timeout_t;
+static timeout_t **timeouts = NULL;	/* heap */
+static size_t n_timeouts = 0;		/* number of entries in the heap */
+static size_t timeouts_size = 0;	/* allocated size of the heap */
+static unsigned long long timeout_seq = 0;
+
+/* Ordering for the heap: earliest first, then first added. */
+#define TO_BEFORE(a, b)	((a)->ts < (b)->ts || \
+			 ((a)->ts == (b)->ts && (a)->seq < (b)->seq))
+
+/* Returns the current monotonic time, in microseconds. */
+static mtime_t
+mtime_now(void)
+{
 #if defined(_WIN32) /*[*/
+    LARGE_INTEGER count, freq;
+
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return ((mtime_t)(count.QuadPart / freq.QuadPart) * MILLION) +
+	((mtime_t)(count.QuadPart % freq.QuadPart) * MILLION) / freq.QuadPart;
+#elif defined(CLOCK_MONOTONIC) /*][*/
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((mtime_t)ts.tv_sec * MILLION) + (ts.tv_nsec / 1000L);
+#else /*][*/
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return ((mtime_t)tv.tv_sec * MILLION) + tv.tv_usec;
+#endif /*]*/
+}
+
+/* Store a timeout in the heap. */
+static void
+timeout_set(size_t ix, timeout_t *t)
+{
+    timeouts[ix] = t;
+    t->ix = ix;
+}
+
+/* Move a heap entry toward the root until the heap is ordered. */
 static void
-ms_ts(unsigned long long *u)
+timeout_sift_up(size_t ix)
 {
-    FILETIME t;
+    timeout_t *t = timeouts[ix];
 
-    /* Get the system time, in 100ns units. */
-    GetSystemTimeAsFileTime(&t);
-    memcpy(u, &t, sizeof(unsigned long long));
+    while (ix > 0) {
+	size_t parent = (ix - 1) / 2;
 
-    /* Divide by 10,000 to get ms. */
-    *u /= 10000ULL;
+	if (!TO_BEFORE(t, timeouts[parent])) {
+	    break;
+	}
+	timeout_set(ix, timeouts[parent]);
+	ix = parent;
+    }
+    timeout_set(ix, t);
 }
-#endif /*]*/
 
-typedef struct timeout {
-    struct timeout *next;
-#if defined(_WIN32) /*[*/
-    unsigned long long ts;
-#else /*][*/
-    struct timeval tv;
-#endif /*]*/
-    tofn_t proc;
-    bool in_play;
-} timeout_t;
-static timeout_t *timeouts = NULL;
+/* Move a heap entry away from the root until the heap is ordered. */
+static void
+timeout_sift_down(size_t ix)
+{
+    timeout_t *t = timeouts[ix];
+
+    for (;;) {
+	size_t child = (2 * ix) + 1;
+
+	if (child >= n_timeouts) {
+	    break;
+	}
+	if (child + 1 < n_timeouts &&
+		TO_BEFORE(timeouts[child + 1], timeouts[child])) {
+	    child++;
+	}
+	if (!TO_BEFORE(timeouts[child], t)) {
+	    break;
+	}
+	timeout_set(ix, timeouts[child]);
+	ix = child;
+    }
+    timeout_set(ix, t);
+}
+
+/* Delete an entry from the heap. */
+static void
+timeout_delete(size_t ix)
+{
+    timeout_t *last = timeouts[--n_timeouts];
+
+    if (ix == n_timeouts) {
+	return;
+    }
+    timeout_set(ix, last);
+    if (ix > 0 && TO_BEFORE(last, timeouts[(ix - 1) / 2])) {
+	timeout_sift_up(ix);
+    } else {
+	timeout_sift_down(ix);
+    }
+}
 
 ioid_t
 AddTimeOut(unsigned long interval_ms, tofn_t proc)
 {
     timeout_t *t_new;
-    timeout_t *t;
-    timeout_t *prev = NULL;
 
     t_new = (timeout_t *)Malloc(sizeof(timeout_t));
     t_new->proc = proc;
     t_new->in_play = false;
-#if defined(_WIN32) /*[*/
-    ms_ts(&t_new->ts);
-    t_new->ts += interval_ms;
-#else /*][*/
-    gettimeofday(&t_new->tv, NULL);
-    t_new->tv.tv_sec += interval_ms / 1000L;
-    t_new->tv.tv_usec += (interval_ms % 1000L) * 1000L;
-    if (t_new->tv.tv_usec > MILLION) {
-	t_new->tv.tv_sec += t_new->tv.tv_usec / MILLION;
-	t_new->tv.tv_usec %= MILLION;
-    }
-#endif /*]*/
-
-    /* Find where to insert this item. */
-    for (t = timeouts; t != NULL; t = t->next) {
-#if defined(_WIN32) /*[*/
-	if (t->ts > t_new->ts)
-#else /*][*/
-	if (t->tv.tv_sec > t_new->tv.tv_sec ||
-	    (t->tv.tv_sec == t_new->tv.tv_sec &&
-	     t->tv.tv_usec > t_new->tv.tv_usec))
-#endif /*]*/
-	{
-	    break;
-	}
-	prev = t;
-    }
+    t_new->ts = mtime_now() + ((mtime_t)interval_ms * 1000ULL);
+    t_new->seq = timeout_seq++;
 
     /* Insert it. */
-    if (prev == NULL) {	/* Front. */
-	t_new->next = timeouts;
-	timeouts = t_new;
-    } else if (t == NULL) {	/* Rear. */
-	t_new->next = NULL;
-	prev->next = t_new;
-    } else {			/* Middle. */
-	t_new->next = t;
-	prev->next = t_new;
+    if (n_timeouts >= timeouts_size) {
+	timeouts_size = timeouts_size? 2 * timeouts_size: 16;
+	timeouts = (timeout_t **)Realloc(timeouts,
+		timeouts_size * sizeof(timeout_t *));
     }
+    timeouts[n_timeouts++] = t_new;
+    timeout_sift_up(n_timeouts - 1);
 
     return (ioid_t)t_new;
 }
@@ -510,29 +574,23 @@ void
 RemoveTimeOut(ioid_t timer)
 {
     timeout_t *st = (timeout_t *)timer;
-    timeout_t *t;
-    timeout_t *prev = NULL;
 
     if (st->in_play) {
 	return;
     }
-    for (t = timeouts; t != NULL; t = t->next) {
-	if (t == st) {
-	    if (prev != NULL) {
-		prev->next = t->next;
-	    } else {
-		timeouts = t->next;
-	    }
-	    Free(t);
-	    return;
-	}
-	prev = t;
+    if (st->ix < n_timeouts && timeouts[st->ix] == st) {
+	timeout_delete(st->ix);
+	Free(st);
     }
 }
 
 /* Input events. */ 
 typedef struct input {  
     struct input *next;
+#if defined(HAVE_SYS_EPOLL_H) /*[*/
+    struct input *fd_next;	/* next input on the same fd */
+    bool unpollable;		/* fd cannot be polled, e.g., a regular file */
+#endif /*]*/
     iosrc_t source; 
     int condition;
     iofn_t proc;
@@ -540,6 +598,158 @@ typedef struct input {
 static input_t *inputs = NULL;
 static bool inputs_changed = false;
 
+#if defined(HAVE_SYS_EPOLL_H) /*[*/
+/*
+ * epoll back end.
+ *
+ * Inputs are registered with the kernel when they are added and removed, so
+ * waiting for events does not depend on the number of inputs, and there is
+ * no FD_SETSIZE limit. The back end is chosen the first time events are
+ * processed; select() is used instead if epoll is unavailable or the
+ * useSelect resource is set.
+ */
+#define MAX_EPOLL_EVENTS	64
+
+static enum {
+    EB_UNKNOWN,		/* not chosen yet */
+    EB_SELECT,		/* select() */
+    EB_EPOLL		/* epoll */
+} event_backend = EB_UNKNOWN;
+static int epfd = -1;			/* epoll descriptor */
+static input_t **fd_inputs = NULL;	/* input chains, indexed by fd */
+static int fd_inputs_size = 0;		/* size of fd_inputs */
+static int n_inputs = 0;		/* number of registered inputs */
+static int n_unpollable = 0;		/* number of unpollable inputs */
+
+/* Update the kernel registration for an fd. */
+static void
+epoll_update(int fd)
+{
+    input_t *ip;
+    struct epoll_event ev;
+
+    memset(&ev, 0, sizeof(ev));
+    ev.data.fd = fd;
+    for (ip = fd_inputs[fd]; ip != NULL; ip = ip->fd_next) {
+	if (ip->condition & InputReadMask) {
+	    ev.events |= EPOLLIN;
+	}
+	if (ip->condition & InputWriteMask) {
+	    ev.events |= EPOLLOUT;
+	}
+	if (ip->condition & InputExceptMask) {
+	    ev.events |= EPOLLPRI;
+	}
+    }
+
+    if (ev.events == 0) {
+	/* The fd may already be closed, so failure here is normal. */
+	epoll_ctl(epfd, EPOLL_CTL_DEL, fd, &ev);
+	return;
+    }
+
+    if (epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ev) == 0 ||
+	    (errno == ENOENT && epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) == 0)) {
+	return;
+    }
+
+    if (errno == EPERM) {
+	/* Not pollable (regular file). select() says it is always ready. */
+	for (ip = fd_inputs[fd]; ip != NULL; ip = ip->fd_next) {
+	    if (!ip->unpollable) {
+		ip->unpollable = true;
+		n_unpollable++;
+	    }
+	}
+    } else {
+	xs_warning("epoll_ctl(%d) failed: %s", fd, strerror(errno));
+    }
+}
+
+/* Link an input into its fd chain and register it. */
+static void
+epoll_link(input_t *ip)
+{
+    int fd = ip->source;
+
+    if (fd >= fd_inputs_size) {
+	int new_size = fd_inputs_size? fd_inputs_size: 64;
+
+	while (new_size <= fd) {
+	    new_size *= 2;
+	}
+	fd_inputs = (input_t **)Realloc(fd_inputs,
+		new_size * sizeof(input_t *));
+	memset(fd_inputs + fd_inputs_size, 0,
+		(new_size - fd_inputs_size) * sizeof(input_t *));
+	fd_inputs_size = new_size;
+    }
+    ip->fd_next = fd_inputs[fd];
+    fd_inputs[fd] = ip;
+    n_inputs++;
+    epoll_update(fd);
+}
+
+/* Unlink an input from its fd chain and update its registration. */
+static void
+epoll_unlink(input_t *ip)
+{
+    input_t **ipp;
+
+    for (ipp = &fd_inputs[ip->source]; *ipp != NULL; ipp = &(*ipp)->fd_next) {
+	if (*ipp == ip) {
+	    *ipp = ip->fd_next;
+	    break;
+	}
+    }
+    if (ip->unpollable) {
+	n_unpollable--;
+    }
+    n_inputs--;
+    epoll_update(ip->source);
+}
+
+/* Choose the event back end, and register any existing inputs. */
+static void
+epoll_init(void)
+{
+    input_t *ip;
+    input_t **ipv;
+    int n = 0;
+    int i;
+
+    if (appres.use_select) {
+	event_backend = EB_SELECT;
+	vtrace("Using select() for events\n");
+	return;
+    }
+    if ((epfd = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+	event_backend = EB_SELECT;
+	vtrace("epoll_create1() failed: %s, using select()\n",
+		strerror(errno));
+	return;
+    }
+    event_backend = EB_EPOLL;
+    vtrace("Using epoll for events\n");
+
+    /* Link existing inputs in reverse, so each fd chain is in list order. */
+    for (ip = inputs; ip != NULL; ip = ip->next) {
+	n++;
+    }
+    if (n == 0) {
+	return;
+    }
+    ipv = (input_t **)Malloc(n * sizeof(input_t *));
+    for (i = 0, ip = inputs; ip != NULL; ip = ip->next) {
+	ipv[i++] = ip;
+    }
+    while (--i >= 0) {
+	epoll_link(ipv[i]);
+    }
+    Free(ipv);
+}
+#endif /*]*/
+
 ioid_t
 AddInput(iosrc_t source, iofn_t fn)
 {
@@ -554,6 +764,12 @@ AddInput(iosrc_t source, iofn_t fn)
     ip->next = inputs;
     inputs = ip;
     inputs_changed = true;
+#if defined(HAVE_SYS_EPOLL_H) /*[*/
+    ip->unpollable = false;
+    if (event_backend == EB_EPOLL) {
+	epoll_link(ip);
+    }
+#endif /*]*/
     return (ioid_t)ip;
 }
 
@@ -572,6 +788,12 @@ AddExcept(iosrc_t source, iofn_t fn)
     ip->next = inputs;
     inputs = ip;
     inputs_changed = true;
+#if defined(HAVE_SYS_EPOLL_H) /*[*/
+    ip->unpollable = false;
+    if (event_backend == EB_EPOLL) {
+	epoll_link(ip);
+    }
+#endif /*]*/
     return (ioid_t)ip;
 #endif /*]*/
 }
@@ -589,6 +811,12 @@ AddOutput(iosrc_t source, iofn_t fn)
     ip->next = inputs;
     inputs = ip;
     inputs_changed = true;
+#if defined(HAVE_SYS_EPOLL_H) /*[*/
+    ip->unpollable = false;
+    if (event_backend == EB_EPOLL) {
+	epoll_link(ip);
+    }
+#endif /*]*/
     return (ioid_t)ip;
 }
 #endif /*]*/
@@ -613,6 +841,11 @@ RemoveInput(ioid_t id)
     } else {
 	inputs = ip->next;
     }
+#if defined(HAVE_SYS_EPOLL_H) /*[*/
+    if (event_backend == EB_EPOLL) {
+	epoll_unlink(ip);
+    }
+#endif /*]*/
     Free(ip);
     inputs_changed = true;
 }
@@ -681,6 +914,147 @@ poll_children(void)
 #define MAX_HA	256
 #endif /*]*/
 
+/*
+ * Run expired timeouts.
+ * Sets *processed_any if any were run.
+ */
+static void
+expire_timeouts(bool *processed_any)
+{
+    mtime_t now;
+    timeout_t *t;
+
+    if (n_timeouts == 0) {
+	return;
+    }
+
+    now = mtime_now();
+    while (n_timeouts > 0) {
+	t = timeouts[0];
+#if defined(_WIN32) /*[*/
+	if (t->ts > now)
+#else /*][*/
+	if (t->ts >= now)
+#endif /*]*/
+	{
+	    break;
+	}
+	timeout_delete(0);
+	t->in_play = true;
+	(*t->proc)((ioid_t)t);
+	*processed_any = true;
+	Free(t);
+    }
+}
+
+#if defined(HAVE_SYS_EPOLL_H) /*[*/
+/*
+ * Inner event dispatcher, epoll version.
+ * Same semantics as process_some_events().
+ */
+static bool
+epoll_process_some_events(bool block, bool *processed_any)
+{
+    struct epoll_event events[MAX_EPOLL_EVENTS];
+    int tmo;
+    int ns;
+    int i;
+    input_t *ip, *ip_next;
+
+    *processed_any = false;
+
+    /* Poll for children. */
+    if (poll_children()) {
+	return false;
+    }
+
+    /* If there's nothing to do now, we're done. */
+    if (n_inputs == 0 && (!block || n_timeouts == 0)) {
+	return true;
+    }
+
+    if (!block || n_unpollable > 0) {
+	/* Don't block. */
+	tmo = 0;
+    } else if (n_timeouts != 0) {
+	/* Compute how long to wait for the first event, rounding up. */
+	mtime_t now = mtime_now();
+
+	tmo = (timeouts[0]->ts > now)?
+	    (int)((timeouts[0]->ts - now + 999) / 1000): 0;
+    } else {
+	/* Block infinitely. */
+	tmo = -1;
+    }
+
+    /* Wait for events. */
+    if (tmo < 0) {
+	vtrace("Waiting for %d event%s\n", n_inputs,
+		(n_inputs == 1)? "": "s");
+    } else {
+	vtrace("Waiting for %d event%s or %u.%03us\n", n_inputs,
+		(n_inputs == 1)? "": "s", tmo / 1000, tmo % 1000);
+    }
+    ns = epoll_wait(epfd, events, MAX_EPOLL_EVENTS, tmo);
+    if (ns < 0) {
+	if (errno != EINTR) {
+	    xs_warning("process_events: epoll_wait() failed: %s",
+		    strerror(errno));
+	}
+	return true;
+    }
+    vtrace("Got %u event%s\n", ns, (ns == 1)? "": "s");
+
+    inputs_changed = false;
+
+    /* Process the event(s) that occurred. */
+    for (i = 0; i < ns; i++) {
+	int fd = events[i].data.fd;
+	uint32_t ev = events[i].events;
+
+	if (fd >= fd_inputs_size) {
+	    continue;
+	}
+	for (ip = fd_inputs[fd]; ip != NULL; ip = ip_next) {
+	    ip_next = ip->fd_next;
+	    if (((ip->condition & InputReadMask) &&
+			(ev & (EPOLLIN | EPOLLHUP | EPOLLERR))) ||
+		((ip->condition & InputWriteMask) &&
+			(ev & (EPOLLOUT | EPOLLHUP | EPOLLERR))) ||
+		((ip->condition & InputExceptMask) && (ev & EPOLLPRI))) {
+		(*ip->proc)(ip->source, (ioid_t)ip);
+		*processed_any = true;
+		if (inputs_changed) {
+		    /* Other events may no longer be valid. Try again. */
+		    return false;
+		}
+	    }
+	}
+    }
+
+    /* Unpollable inputs are always ready for reading and writing. */
+    if (n_unpollable > 0) {
+	for (ip = inputs; ip != NULL; ip = ip_next) {
+	    ip_next = ip->next;
+	    if (ip->unpollable &&
+		    (ip->condition & (InputReadMask | InputWriteMask))) {
+		(*ip->proc)(ip->source, (ioid_t)ip);
+		*processed_any = true;
+		if (inputs_changed) {
+		    return false;
+		}
+	    }
+	}
+    }
+
+    /* See what's expired. */
+    expire_timeouts(processed_any);
+
+    /* If inputs have changed, retry. */
+    return !inputs_changed;
+}
+#endif /*]*/
+
 /*
  * Inner event dispatcher.
  * Processes one or more pending I/O and timeout events.
@@ -700,32 +1074,33 @@ process_some_events(bool block, bool *processed_any)
     DWORD nha;
     DWORD tmo;
     DWORD ret;
-    unsigned long long now;
     int i;
 #else /*][*/
     int ne = 0;
     fd_set rfds, wfds, xfds;
     int ns;
-    struct timeval now, twait, *tp;
+    struct timeval twait, *tp;
 #endif /*]*/
     input_t *ip, *ip_next;
-    struct timeout *t;
     bool any_events_pending;
 
 #   if defined(_WIN32) /*[*/
 #    define SOURCE_READY    (ret == WAIT_OBJECT_0 + i)
 #    define WAIT_BAD        (ret == WAIT_FAILED)
-#    define GET_TS(v)       ms_ts(v)
-#    define EXPIRED(t, now) (t->ts <= now)
 #   else /*][*/
 #    define SOURCE_READY    FD_ISSET(ip->source, &rfds)
 #    define WAIT_BAD        (ns < 0)
-#    define GET_TS(v)       gettimeofday(v, NULL);
-#    define EXPIRED(t, now) (t->tv.tv_sec < now.tv_sec || \
-			     (t->tv.tv_sec == now.tv_sec && \
-			      t->tv.tv_usec < now.tv_usec))
 #   endif /*]*/
 
+#if defined(HAVE_SYS_EPOLL_H) /*[*/
+    if (event_backend == EB_UNKNOWN) {
+	epoll_init();
+    }
+    if (event_backend == EB_EPOLL) {
+	return epoll_process_some_events(block, processed_any);
+    }
+#endif /*]*/
+
     *processed_any = false;
 
     any_events_pending = false;
@@ -767,25 +1142,16 @@ process_some_events(bool block, bool *processed_any)
     }
 
     if (block) {
-	if (timeouts != NULL) {
+	if (n_timeouts != 0) {
 	    /* Compute how long to wait for the first event. */
-	    GET_TS(&now);
+	    mtime_t now = mtime_now();
+	    mtime_t wait = (timeouts[0]->ts > now)? timeouts[0]->ts - now: 0;
+
 #if defined(_WIN32) /*[*/
-	    if (now > timeouts->ts) {
-		tmo = 0;
-	    } else {
-		tmo = (DWORD)(timeouts->ts - now);
-	    }
+	    tmo = (DWORD)((wait + 999) / 1000);
 #else /*][*/
-	    twait.tv_sec = timeouts->tv.tv_sec - now.tv_sec;
-	    twait.tv_usec = timeouts->tv.tv_usec - now.tv_usec;
-	    if (twait.tv_usec < 0L) {
-		twait.tv_sec--;
-		twait.tv_usec += MILLION;
-	    }
-	    if (twait.tv_sec < 0L) {
-		twait.tv_sec = twait.tv_usec = 0L;
-	    }
+	    twait.tv_sec = (long)(wait / MILLION);
+	    twait.tv_usec = (long)(wait % MILLION);
 	    tp = &twait;
 #endif /*]*/
 	    any_events_pending = true;
@@ -920,20 +1286,7 @@ process_some_events(bool block, bool *processed_any)
     }
 
     /* See what's expired. */
-    if (timeouts != NULL) {
-	GET_TS(&now);
-	while ((t = timeouts) != NULL) {
-	    if (EXPIRED(t, now)) {
-		timeouts = t->next;
-		t->in_play = true;
-		(*t->proc)((ioid_t)t);
-		*processed_any = true;
-		Free(t);
-	    } else {
-		break;
-	    }
-	}
-    }
+    expire_timeouts(processed_any);
 
     /* If inputs have changed, retry. */
     return !inputs_changed;
@@ -958,6 +1311,9 @@ process_events(bool block)
 	    return true;
 	}
 
+	/* Write pending trace output before waiting. */
+	trace_flush();
+
 	/* Process some events. */
 	done = process_some_events(block, &any_this_time);
 
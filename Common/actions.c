@@ -50,6 +50,17 @@
 llist_t actions_list = LLIST_INIT(actions_list);
 unsigned actions_list_count;
 
+/*
+ * Action name index: an open-addressed hash table for exact lookups, and an
+ * array sorted by name for abbreviations. Both are keyed case-insensitively.
+ * The sorted array is rebuilt lazily after new actions are registered.
+ */
+static action_elt_t **action_hash;
+static unsigned action_hash_size;
+static action_elt_t **action_sorted;
+static unsigned action_sorted_count;
+static bool action_sorted_valid = false;
+
 enum iaction ia_cause;
 const char *ia_name[] = {
     "none", "string", "paste", "screen-redraw", "keypad", "default", "macro",
@@ -82,8 +93,6 @@ init_suppressed(const char *actions)
     a = lazya(NewString(actions));
     while ((action = strtok(a, " \t\r\n")) != NULL) {
 	size_t sl = strlen(action);
-	action_elt_t *e;
-	bool found = false;
 
 	/* Prime for the next strtok() call. */
 	a = NULL;
@@ -95,13 +104,7 @@ init_suppressed(const char *actions)
 	}
 
 	/* Make sure the action they are suppressing is real. */
-	FOREACH_LLIST(&actions_list, e, action_elt_t *) {
-	    if (!strcasecmp(e->t.name, action)) {
-		found = true;
-		break;
-	    }
-	} FOREACH_LLIST_END(&actions_list, e, action_elt_t *);
-	if (!found) {
+	if (lookup_action(action) == NULL) {
 	    vtrace("Warning: action '%s' in %s not found\n", action,
 		    ResSuppressActions);
 	    continue;
@@ -322,6 +325,144 @@ run_action_entry(action_elt_t *e, enum iaction cause, unsigned count,
     return ret;
 }
 
+/* Hash an action name, ignoring case. */
+static unsigned
+action_name_hash(const char *name)
+{
+    unsigned h = 5381;
+
+    while (*name) {
+	h = (h * 33) ^ (unsigned char)tolower((unsigned char)*name++);
+    }
+    return h;
+}
+
+/* Add an action to the hash table, growing it as needed. */
+static void
+action_hash_add(action_elt_t *e)
+{
+    unsigned h;
+
+    if ((actions_list_count + 1) * 4 >= action_hash_size * 3) {
+	action_elt_t **old = action_hash;
+	unsigned old_size = action_hash_size;
+	unsigned i;
+
+	action_hash_size = old_size? old_size * 2: 256;
+	action_hash = (action_elt_t **)Calloc(action_hash_size,
+		sizeof(action_elt_t *));
+	for (i = 0; i < old_size; i++) {
+	    if (old[i] != NULL) {
+		h = action_name_hash(old[i]->t.name) & (action_hash_size - 1);
+		while (action_hash[h] != NULL) {
+		    h = (h + 1) & (action_hash_size - 1);
+		}
+		action_hash[h] = old[i];
+	    }
+	}
+	Free(old);
+    }
+
+    h = action_name_hash(e->t.name) & (action_hash_size - 1);
+    while (action_hash[h] != NULL) {
+	h = (h + 1) & (action_hash_size - 1);
+    }
+    action_hash[h] = e;
+}
+
+/**
+ * Look up an action by its full name, ignoring case.
+ *
+ * @param[in] name	Action name
+ *
+ * @returns Action, or NULL
+ */
+action_elt_t *
+lookup_action(const char *name)
+{
+    unsigned h;
+
+    if (action_hash == NULL) {
+	return NULL;
+    }
+    h = action_name_hash(name) & (action_hash_size - 1);
+    while (action_hash[h] != NULL) {
+	if (!strcasecmp(action_hash[h]->t.name, name)) {
+	    return action_hash[h];
+	}
+	h = (h + 1) & (action_hash_size - 1);
+    }
+    return NULL;
+}
+
+/* Compare two action elements by name, for the sorted index. */
+static int
+action_elt_cmp(const void *a, const void *b)
+{
+    return strcasecmp((*(action_elt_t **)a)->t.name,
+	    (*(action_elt_t **)b)->t.name);
+}
+
+/**
+ * Look up an action by a unique abbreviation of its name, ignoring case.
+ * An exact match is always unique.
+ *
+ * @param[in] prefix	Abbreviated action name
+ * @param[out] ambiguous Returned true if more than one action matches
+ *
+ * @returns Action, or NULL
+ */
+action_elt_t *
+lookup_action_prefix(const char *prefix, bool *ambiguous)
+{
+    size_t len = strlen(prefix);
+    unsigned lo, hi;
+    action_elt_t *e;
+
+    *ambiguous = false;
+    if ((e = lookup_action(prefix)) != NULL) {
+	return e;
+    }
+
+    if (!action_sorted_valid) {
+	action_elt_t *f;
+	unsigned i = 0;
+
+	Replace(action_sorted, (action_elt_t **)Malloc(actions_list_count *
+		    sizeof(action_elt_t *)));
+	FOREACH_LLIST(&actions_list, f, action_elt_t *) {
+	    action_sorted[i++] = f;
+	} FOREACH_LLIST_END(&actions_list, f, action_elt_t *);
+	action_sorted_count = i;
+	qsort((void *)action_sorted, action_sorted_count,
+		sizeof(action_elt_t *), action_elt_cmp);
+	action_sorted_valid = true;
+    }
+
+    /* Find the first name not less than the prefix. */
+    lo = 0;
+    hi = action_sorted_count;
+    while (lo < hi) {
+	unsigned mid = lo + (hi - lo) / 2;
+
+	if (strncasecmp(action_sorted[mid]->t.name, prefix, len) < 0) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid;
+	}
+    }
+    if (lo >= action_sorted_count ||
+	    strncasecmp(action_sorted[lo]->t.name, prefix, len)) {
+	return NULL;
+    }
+    if (lo + 1 < action_sorted_count &&
+	    !strncasecmp(action_sorted[lo + 1]->t.name, prefix, len)) {
+	*ambiguous = true;
+	return NULL;
+    }
+    return action_sorted[lo];
+}
+
 /*
  * Register a group of actions.
  *
@@ -338,16 +479,15 @@ register_actions(action_table_t *new_actions, unsigned count)
 	action_elt_t *e;
 	action_elt_t *before;
 
+	if ((e = lookup_action(new_actions[i].name)) != NULL) {
+	    /* Replace. */
+	    e->t = new_actions[i]; /* struct copy */
+	    return;
+	}
+
 	before = NULL;
 	FOREACH_LLIST(&actions_list, e, action_elt_t *) {
-	    int cmp;
-
-	    cmp = strcasecmp(e->t.name, new_actions[i].name);
-	    if (cmp == 0) {
-		/* Replace. */
-		e->t = new_actions[i]; /* struct copy */
-		return;
-	    } else if (cmp < 0) {
+	    if (strcasecmp(e->t.name, new_actions[i].name) < 0) {
 		/* Goes ahead of this one. */
 		before = e;
 		break;
@@ -366,7 +506,9 @@ register_actions(action_table_t *new_actions, unsigned count)
 	    LLIST_APPEND(&e->list, actions_list);
 	}
 
+	action_hash_add(e);
 	actions_list_count++;
+	action_sorted_valid = false;
     }
 }
 
@@ -571,6 +571,7 @@ POSSIBILITY OF SUCH DAMAGE.", cyear),
 
     /* Process events forever. */
     while (1) {
+	ui_flush();
 	process_events(true);
 	screen_disp(false);
     }
@@ -947,6 +948,9 @@ b3270_register(void)
     static opt_t b3270_opts[] = {
 	{ OptCallback, OPT_STRING,  false, ResCallback,
 	    aoffset(scripting.callback), NULL, "Callback address and port" },
+	{ OptUiBinary, OPT_BOOLEAN, true,  ResUiBinary,
+	    aoffset(scripting.ui_binary), NULL,
+	    "Use the binary UI output protocol" },
 	{ OptUtf8,     OPT_BOOLEAN, true,  ResUtf8,      aoffset(utf8),
 	    NULL, "Force local codeset to be UTF-8" },
     };
@@ -955,6 +959,7 @@ b3270_register(void)
 	{ ResIdleCommand,aoffset(idle_command),     XRM_STRING },
 	{ ResIdleCommandEnabled,aoffset(idle_command_enabled),XRM_BOOLEAN },
 	{ ResIdleTimeout,aoffset(idle_timeout),     XRM_STRING },
+	{ ResUiBinary,	aoffset(scripting.ui_binary), XRM_BOOLEAN },
 	{ ResUtf8,		aoffset(utf8),      XRM_BOOLEAN },
     };
     static xres_t b3270_xresources[] = {
@@ -340,51 +340,65 @@ uncircle(unsigned long uc)
     return 'A' + (uc - CIRCLED_A);
 }
 
+/*
+ * Compute the display attributes of the field attribute at 'fa_addr'.
+ */
+static void
+field_state(struct ea *ea, int fa_addr, unsigned char *fa, int *fa_fg,
+	int *fa_bg, int *fa_gr, bool *fa_high)
+{
+    *fa = ea[fa_addr].fa;
+    if (ea[fa_addr].fg) {
+	*fa_fg = ea[fa_addr].fg & 0x0f;
+    } else {
+	*fa_fg = color_from_fa(*fa);
+    }
+    if (ea[fa_addr].bg) {
+	*fa_bg = ea[fa_addr].bg & 0x0f;
+    } else {
+	*fa_bg = HOST_COLOR_NEUTRAL_BLACK;
+    }
+    if (ea[fa_addr].gr & GR_INTENSIFY) {
+	*fa_high = true;
+    } else {
+	*fa_high = FA_IS_HIGH(*fa);
+    }
+    *fa_gr = ea[fa_addr].gr;
+}
+
 /*
  * Render the screen into a buffer.
  *
  * ea: ROWS*COLS screen buffer to render
+ * changed_only: render only the rows reported by ctlr_changed_rows()
  * s: maxROWS*maxCOLS screen_t to render into
  */
 void
-render_screen(struct ea *ea, screen_t *s)
+render_screen(struct ea *ea, bool changed_only, screen_t *s)
 {
     int i;
     ucs4_t uc;
-    int fa_addr = find_field_attribute(0);
-    unsigned char fa = ea[fa_addr].fa;
+    unsigned char fa;
     int fa_fg;
     int fa_bg;
     int fa_gr;
     bool fa_high;
+    bool skipped = false;
 
     /* Start with all blanks, blue on black. */
-    memset(s, 0, maxROWS * maxCOLS * sizeof(screen_t));
     for (i = 0; i < maxROWS * maxCOLS; i++) {
+	if (changed_only && !ctlr_row_changed(i / maxCOLS)) {
+	    i += maxCOLS - 1;
+	    continue;
+	}
+	memset(&s[i], 0, sizeof(screen_t));
 	s[i].ccode = ' ';
 	s[i].fg = mode.m3279? HOST_COLOR_BLUE : HOST_COLOR_NEUTRAL_WHITE;
 	s[i].bg = HOST_COLOR_NEUTRAL_BLACK;
     }
 
-    if (ea[fa_addr].fg) {
-	fa_fg = ea[fa_addr].fg & 0x0f;
-    } else {
-	fa_fg = color_from_fa(fa);
-    }
-
-    if (ea[fa_addr].bg) {
-	fa_bg = ea[fa_addr].bg & 0x0f;
-    } else {
-	fa_bg = HOST_COLOR_NEUTRAL_BLACK;
-    }
-
-    if (ea[fa_addr].gr & GR_INTENSIFY) {
-	fa_high = true;
-    } else {
-	fa_high = FA_IS_HIGH(fa);
-    }
-
-    fa_gr = ea[fa_addr].gr;
+    field_state(ea, find_field_attribute(0), &fa, &fa_fg, &fa_bg, &fa_gr,
+	    &fa_high);
 
     for (i = 0; i < ROWS * COLS; i++) {
 	int fg_color, bg_color;
@@ -395,27 +409,25 @@ render_screen(struct ea *ea, screen_t *s)
 	bool pua = false;
 	bool no_copy = false;
 
+	/* Skip unchanged rows, picking up the field state after them. */
+	if (changed_only && !(i % COLS)) {
+	    if (!ctlr_row_changed(i / COLS)) {
+		i += COLS - 1;
+		skipped = true;
+		continue;
+	    }
+	    if (skipped) {
+		field_state(ea, find_field_attribute_ea(i, ea), &fa, &fa_fg,
+			&fa_bg, &fa_gr, &fa_high);
+		skipped = false;
+	    }
+	}
+
 	uc = 0;
 
 	if (ea[i].fa) {
 	    uc = ' ';
-	    fa = ea[i].fa;
-	    if (ea[i].fg) {
-		fa_fg = ea[i].fg & 0x0f;
-	    } else {
-		fa_fg = color_from_fa(fa);
-	    }
-	    if (ea[i].bg) {
-		fa_bg = ea[i].bg & 0x0f;
-	    } else {
-		fa_bg = HOST_COLOR_NEUTRAL_BLACK;
-	    }
-	    if (ea[i].gr & GR_INTENSIFY) {
-		fa_high = true;
-	    } else {
-		fa_high = FA_IS_HIGH(fa);
-	    }
-	    fa_gr = ea[i].gr;
+	    field_state(ea, i, &fa, &fa_fg, &fa_bg, &fa_gr, &fa_high);
 	} else if (FA_IS_ZERO(fa)) {
 	    if (ctlr_dbcs_state(i) == DBCS_LEFT) {
 		uc = 0x3000;
@@ -873,7 +885,7 @@ emit_cursor_cond(bool with_screen)
  * Emit the diff between two screens.
  */
 static void
-emit_diff(screen_t *old, screen_t *new)
+emit_diff(screen_t *old, screen_t *new, bool changed_only)
 {
     int row;
 
@@ -882,7 +894,8 @@ emit_diff(screen_t *old, screen_t *new)
 
     for (row = 0; row < maxROWS; row++) {
 
-	if (memcmp(old + (row * maxCOLS), new + (row * maxCOLS),
+	if ((!changed_only || ctlr_row_changed(row)) &&
+		memcmp(old + (row * maxCOLS), new + (row * maxCOLS),
 		sizeof(screen_t) * maxCOLS)) {
 	    ui_vpush("row",
 		    AttrRow, lazyaf("%d", row + 1),
@@ -905,8 +918,27 @@ cursor_move(int baddr)
     cursor_addr = baddr;
 }
 
+/*
+ * Check a row of ea_buf for emptiness.
+ */
+static bool
+row_is_empty(int row)
+{
+    int i;
+
+    for (i = row * COLS; i < (row + 1) * COLS; i++) {
+	if (memcmp(&ea_buf[i], &zero_ea, sizeof(struct ea))) {
+	    return false;
+	}
+    }
+    return true;
+}
+
 /*
  * Display a changed screen, perhaps unconditionally.
+ *
+ * Unless 'always' is set or the screen has been resized, only the rows that
+ * the controller reports as changed are rendered and compared.
  */
 static void
 screen_disp_cond(bool always)
@@ -914,8 +946,10 @@ screen_disp_cond(bool always)
     bool sent_erase = false;
     size_t se = ROWS * COLS * sizeof(struct ea);
     size_t ss = maxROWS * maxCOLS * sizeof(screen_t);
+    bool changed_only;
+    int first_row, last_row;
     bool empty;
-    int i;
+    int row;
     screen_t *s;
     static bool xformatted = false;
 
@@ -929,21 +963,57 @@ screen_disp_cond(bool always)
 	save_empty();
     }
 
+    changed_only = !always &&
+	!sent_erase &&
+	saved_rows == ROWS &&
+	saved_cols == COLS;
+
     /* Check for no change. */
-    if (!always &&
+    if (!ctlr_changed_rows(&first_row, &last_row)) {
+	if (changed_only) {
+	    emit_cursor_cond(true);
+	    return;
+	}
+	changed_only = false;
+    }
+    if (changed_only) {
+	/* Drop rows that changed and then changed back. */
+	for (row = first_row; row <= last_row; row++) {
+	    if (ctlr_row_changed(row) &&
+		    memcmp(saved_ea + (row * COLS), ea_buf + (row * COLS),
+			COLS * sizeof(struct ea))) {
+		break;
+	    }
+	}
+	if (row > last_row) {
+	    ctlr_changed_rows_reset();
+	    emit_cursor_cond(true);
+	    return;
+	}
+    } else if (!always &&
 	saved_rows == ROWS &&
 	saved_cols == COLS &&
 	!memcmp(saved_ea, ea_buf, se)) {
+	ctlr_changed_rows_reset();
 	emit_cursor_cond(true);
 	return;
     }
 
-    /* Check for now empty. */
+    /*
+     * Check for now empty. Unchanged rows are only worth checking if every
+     * changed row is empty.
+     */
     empty = true;
-    for (i = 0; i < ROWS * COLS; i++) {
-	if (memcmp(&ea_buf[i], &zero_ea, sizeof(struct ea))) {
-	    empty = false;
-	    break;
+    for (row = 0; empty && row < ROWS; row++) {
+	if (!changed_only || ctlr_row_changed(row)) {
+	    empty = row_is_empty(row);
+	}
+    }
+    if (empty && changed_only && !saved_ea_is_empty) {
+	for (row = 0; empty && row < ROWS; row++) {
+	    if (!ctlr_row_changed(row)) {
+		empty = row_is_empty(row);
+	    }
 	}
     }
     if (empty) {
@@ -956,6 +1026,7 @@ screen_disp_cond(bool always)
 	}
 	/* Remember that the screen is empty. */
 	save_empty();
+	ctlr_changed_rows_reset();
 	emit_cursor_cond(true);
 	return;
     }
@@ -969,18 +1040,31 @@ screen_disp_cond(bool always)
 
     /* Render the new screen. */
     s = Malloc(ss);
-    render_screen(ea_buf, s);
+    if (changed_only) {
+	memcpy(s, saved_s, ss);
+    }
+    render_screen(ea_buf, changed_only, s);
 
     /* Tell them what the screen looks like now. */
-    emit_diff(saved_s, s);
+    emit_diff(saved_s, s, changed_only);
 
     /* Save the screen for next time. */
-    Replace(saved_ea, Malloc(se));
-    memcpy(saved_ea, ea_buf, se);
+    if (changed_only) {
+	for (row = first_row; row <= last_row; row++) {
+	    if (ctlr_row_changed(row)) {
+		memcpy(saved_ea + (row * COLS), ea_buf + (row * COLS),
+			COLS * sizeof(struct ea));
+	    }
+	}
+    } else {
+	Replace(saved_ea, Malloc(se));
+	memcpy(saved_ea, ea_buf, se);
+    }
     saved_ea_is_empty = false;
     Replace(saved_s, s);
     saved_rows = ROWS;
     saved_cols = COLS;
+    ctlr_changed_rows_reset();
 }
 
 /*
@@ -1037,6 +1121,17 @@ screen_scroll(unsigned char fg, unsigned char bg)
 	    NULL);
 }
 
+/*
+ * Pending changes do not need to be sent before a scroll: saved_ea and the
+ * row change flags move along with the rows, so they are sent afterwards, in
+ * their new positions.
+ */
+bool
+screen_scroll_needs_sync(void)
+{
+    return false;
+}
+
 /* Left-to-right swap support. */
 void
 screen_flip(void)
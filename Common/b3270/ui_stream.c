@@ -47,6 +47,7 @@
 #include "appres.h"
 #include "3270ds.h"
 #include "b3270proto.h"
+#include "bintrace.h"
 #include "bind-opt.h"
 #include "b_password.h"
 #include "lazya.h"
@@ -56,6 +57,7 @@
 #include "task.h"
 #include "trace.h"
 #include "utils.h"
+#include "varbuf.h"
 #include "xio.h"
 
 #if defined(_WIN32) /*[*/
@@ -68,6 +70,15 @@
 
 #define INBUF_SIZE	8192
 
+#define OUTBUF_FLUSH	(64 * 1024)	/* try to write at this much output */
+#define OUTBUF_MAX	(1024 * 1024)	/* block writing at this much output */
+
+#if defined(MSG_DONTWAIT) /*[*/
+# define UI_DONTWAIT	MSG_DONTWAIT
+#else /*][*/
+# define UI_DONTWAIT	0
+#endif /*]*/
+
 #if defined(_WIN32) /*[*/
 static HANDLE peer_thread;
 static HANDLE peer_enable_event, peer_done_event;
@@ -140,72 +151,191 @@ static tcb_t cb_ui = {
 
 static socket_t ui_socket = INVALID_SOCKET;
 
-/* Write to the UI socket. */
+/*
+ * Output to the UI is accumulated in a buffer, which is written once per pass
+ * through the event loop, or sooner if it gets large.
+ *
+ * If the UI is a socket and it cannot keep up, the rest of the buffer is
+ * written when the socket becomes writable, so the emulator can keep running.
+ * Once OUTBUF_MAX bytes are pending, writes block until the UI catches up.
+ */
+static varbuf_t ui_outbuf;		/* pending output */
+static size_t ui_written;		/* bytes of ui_outbuf already written */
+static size_t ui_traced;		/* bytes of ui_outbuf already traced */
+static bool ui_broken;			/* writes have failed */
+static ioid_t ui_output_id = NULL_IOID;	/* output-ready callback */
+static bool ui_binary;			/* using the binary protocol */
+
+static void ui_write(bool block);
+
+/* Trace UI output that has not been traced yet. */
 static void
-uprintf(const char *fmt, ...)
+ui_trace_output(void)
 {
-    va_list ap;
-    char *s;
     static bool eol = true;
-    ssize_t nw;
+    const char *s = vb_buf(&ui_outbuf) + ui_traced;
+    const char *end = vb_buf(&ui_outbuf) + vb_len(&ui_outbuf);
 
-    va_start(ap, fmt);
-    s = xs_vbuffer(fmt, ap);
-    va_end(ap);
-    if (ui_socket != INVALID_SOCKET) {
-	nw = send(ui_socket, s, strlen(s), 0);
-    } else {
-	nw = write(fileno(stdout), s, strlen(s));
+    if (ui_binary) {
+	/* Binary output is traced as it is generated. */
+	ui_traced = vb_len(&ui_outbuf);
+	return;
     }
 
-    if (eol) {
-	vtrace("ui> ");
-	eol = false;
+    while (s < end) {
+	const char *nl = memchr(s, '\n', end - s);
+	size_t len = nl? (size_t)(nl + 1 - s): (size_t)(end - s);
+
+	vtrace("%s%.*s", eol? "ui> ": "", (int)len, s);
+	eol = (nl != NULL);
+	s += len;
     }
-    vtrace("%s", s);
-    if (strlen(s) > 0 && s[strlen(s) - 1] == '\n') {
-	eol = true;
+    ui_traced = vb_len(&ui_outbuf);
+}
+
+#if !defined(_WIN32) /*[*/
+/* The UI socket is writable again. */
+static void
+ui_output_ready(iosrc_t fd _is_unused, ioid_t id _is_unused)
+{
+    ui_write(false);
+}
+#endif /*]*/
+
+/*
+ * Write pending output to the UI.
+ * If block is true, or there is too much pending, write all of it.
+ */
+static void
+ui_write(bool block)
+{
+    if (ui_broken) {
+	return;
     }
-    Free(s);
-    if (nw < 0) {
-	vtrace("UI write failure\n");
-	x3270_exit(1);
+    if (vb_len(&ui_outbuf) - ui_written > OUTBUF_MAX) {
+	block = true;
     }
+    ui_trace_output();
+
+    while (ui_written < vb_len(&ui_outbuf)) {
+	const char *buf = vb_buf(&ui_outbuf) + ui_written;
+	size_t len = vb_len(&ui_outbuf) - ui_written;
+	ssize_t nw;
+
+	if (ui_socket != INVALID_SOCKET) {
+	    nw = send(ui_socket, buf, len, block? 0: UI_DONTWAIT);
+	} else {
+	    nw = write(fileno(stdout), buf, len);
+	}
+	if (nw < 0) {
+	    if (ui_socket != INVALID_SOCKET && !block &&
+		    socket_errno() == SE_EWOULDBLOCK) {
+		break;
+	    }
+#if !defined(_WIN32) /*[*/
+	    if (errno == EINTR) {
+		continue;
+	    }
+#endif /*]*/
+	    ui_broken = true;
+	    vb_reset(&ui_outbuf);
+	    ui_written = ui_traced = 0;
+	    vtrace("UI write failure\n");
+	    x3270_exit(1);
+	    return;
+	}
+	ui_written += nw;
+    }
+
+    if (ui_written < vb_len(&ui_outbuf)) {
+	/* Wait for the UI to catch up. */
+#if !defined(_WIN32) /*[*/
+	if (ui_output_id == NULL_IOID) {
+	    ui_output_id = AddOutput(ui_socket, ui_output_ready);
+	}
+#endif /*]*/
+	return;
+    }
+
+    /* All written. */
+    vb_reset(&ui_outbuf);
+    ui_written = ui_traced = 0;
+    if (ui_output_id != NULL_IOID) {
+	RemoveInput(ui_output_id);
+	ui_output_id = NULL_IOID;
+    }
+}
+
+/* Write a counted string to the UI. */
+static void
+uputs(const char *s, size_t len)
+{
+    vb_append(&ui_outbuf, s, len);
+    if (vb_len(&ui_outbuf) - ui_written >= OUTBUF_FLUSH) {
+	ui_write(false);
+    }
+}
+
+/* Write to the UI. */
+static void
+uprintf(const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    vb_vappendf(&ui_outbuf, fmt, ap);
+    va_end(ap);
+    if (vb_len(&ui_outbuf) - ui_written >= OUTBUF_FLUSH) {
+	ui_write(false);
+    }
+}
+
+/*
+ * Flush pending UI output.
+ * Called once per pass through the event loop.
+ */
+void
+ui_flush(void)
+{
+    ui_write(false);
 }
 
 /* Dump a string in HTML quoted format, if needed. */
 static void
 xml_safe(const char *value)
 {
+    const char *run = value;	/* start of text not needing quoting */
     char s;
 
-    while ((s = *value++)) {
+    while ((s = *value) != '\0') {
 	unsigned char c = s;
+	const char *quoted;
 
 	if ((c & 0x80) && (c < 0x86 || c > 0x9f)) {
 	    /* UTF-8 upper. */
-	    uprintf("%c", c);
+	    value++;
+	    continue;
 	} else if (c >= ' ' && c != 0x7f) {
 	    /* Printable, but might need quoting. */
 	    switch (c) {
 	    case '<':
-		uprintf("&lt;");
+		quoted = "&lt;";
 		break;
 	    case '>':
-		uprintf("&gt;");
+		quoted = "&gt;";
 		break;
 	    case '"':
-		uprintf("&quot;");
+		quoted = "&quot;";
 		break;
 	    case '&':
-		uprintf("&amp;");
+		quoted = "&amp;";
 		break;
 	    case '\'':
-		uprintf("&apos;");
+		quoted = "&apos;";
 		break;
 	    default:
-		uprintf("%c", c);
-		break;
+		value++;
+		continue;
 	    }
 	} else {
 	    /*
@@ -214,15 +344,195 @@ xml_safe(const char *value)
 	     */
 	    switch (c) {
 	    case 9:
+		quoted = "&#9;";
+		break;
 	    case 10:
+		quoted = "&#10;";
+		break;
 	    case 13:
-		uprintf("&#%u;", c);
+		quoted = "&#13;";
 		break;
 	    default:
-		uprintf(" ");
+		quoted = " ";
 		break;
 	    }
 	}
+
+	/* Write what we have skipped over, then the quoted character. */
+	uputs(run, value - run);
+	uputs(quoted, strlen(quoted));
+	run = ++value;
+    }
+    uputs(run, value - run);
+}
+
+/* Binary protocol name table, hashed by name. */
+typedef struct {
+    char *name;
+    unsigned long index;
+} bin_name_t;
+static bin_name_t *bin_names;
+static unsigned long bin_names_size;
+static unsigned long bin_names_count;
+
+/* Short string values are also sent as names, up to a limit. */
+#define BIN_VALUE_NAME_LEN	16
+#define BIN_MAX_NAMES		4096
+
+/* Append a varint to a buffer. */
+static void
+bin_varint(varbuf_t *r, unsigned long v)
+{
+    unsigned char buf[VARINT_MAX];
+
+    vb_append(r, (char *)buf, varint_put(buf, v) - buf);
+}
+
+/* Write a binary record to the UI. */
+static void
+bin_record(unsigned char type, const varbuf_t *payload)
+{
+    varbuf_t r;
+    char t = (char)type;
+
+    vb_init(&r);
+    vb_append(&r, &t, 1);
+    bin_varint(&r, payload? vb_len(payload): 0);
+    uputs(vb_buf(&r), vb_len(&r));
+    vb_free(&r);
+    if (payload != NULL && vb_len(payload)) {
+	uputs(vb_buf(payload), vb_len(payload));
+    }
+}
+
+/* Hash a name. */
+static unsigned long
+bin_hash(const char *name)
+{
+    unsigned long h = 5381;
+
+    while (*name) {
+	h = (h * 33) ^ (unsigned char)*name++;
+    }
+    return h;
+}
+
+/*
+ * Map a name to its index, defining it if it is new.
+ * Returns -1 if it is new and define is false, or the table is full.
+ */
+static long
+bin_name_index(const char *name, bool define)
+{
+    unsigned long h;
+    varbuf_t r;
+
+    if (bin_names_count * 4 >= bin_names_size * 3) {
+	bin_name_t *old = bin_names;
+	unsigned long old_size = bin_names_size;
+	unsigned long i;
+
+	bin_names_size = old_size? old_size * 2: 256;
+	bin_names = (bin_name_t *)Calloc(bin_names_size, sizeof(bin_name_t));
+	for (i = 0; i < old_size; i++) {
+	    if (old[i].name != NULL) {
+		h = bin_hash(old[i].name) & (bin_names_size - 1);
+		while (bin_names[h].name != NULL) {
+		    h = (h + 1) & (bin_names_size - 1);
+		}
+		bin_names[h] = old[i];
+	    }
+	}
+	Free(old);
+    }
+
+    h = bin_hash(name) & (bin_names_size - 1);
+    while (bin_names[h].name != NULL) {
+	if (!strcmp(bin_names[h].name, name)) {
+	    return (long)bin_names[h].index;
+	}
+	h = (h + 1) & (bin_names_size - 1);
+    }
+    if (!define) {
+	return -1;
+    }
+    bin_names[h].name = NewString(name);
+    bin_names[h].index = bin_names_count++;
+
+    /* Tell the UI about it. */
+    vb_init(&r);
+    bin_varint(&r, bin_names[h].index);
+    vb_appends(&r, name);
+    bin_record(BinDefine, &r);
+    vb_free(&r);
+    return (long)bin_names[h].index;
+}
+
+/* Append a value to a binary record. */
+static void
+bin_value(varbuf_t *r, const char *value)
+{
+    const char *digits = (*value == '-')? value + 1: value;
+    size_t nd = strspn(digits, "0123456789");
+    size_t len;
+    long ix;
+    char type;
+
+    /* Send canonical decimal integers as numbers. */
+    if (nd > 0 && nd <= 9 && digits[nd] == '\0' &&
+	    (digits[0] != '0' || (nd == 1 && digits == value))) {
+	type = (digits == value)? BinValUint: BinValNint;
+	vb_append(r, &type, 1);
+	bin_varint(r, strtoul(digits, NULL, 10));
+	return;
+    }
+
+    /* Send short strings, which tend to repeat, as names. */
+    len = strlen(value);
+    if (len <= BIN_VALUE_NAME_LEN &&
+	    (ix = bin_name_index(value,
+				 bin_names_count < BIN_MAX_NAMES)) >= 0) {
+	type = BinValName;
+	vb_append(r, &type, 1);
+	bin_varint(r, (unsigned long)ix);
+	return;
+    }
+
+    type = BinValString;
+    vb_append(r, &type, 1);
+    bin_varint(r, len);
+    vb_append(r, value, len);
+}
+
+/*
+ * Generate a binary object, either leaf or container.
+ * The attributes are an array of n tag and value pairs.
+ */
+static void
+bin_object(bool leaf, const char *name, const char **attrs, unsigned n)
+{
+    unsigned long name_ix = bin_name_index(name, true);
+    varbuf_t r;
+    unsigned i;
+
+    vb_init(&r);
+    bin_varint(&r, name_ix);
+    bin_varint(&r, n);
+    for (i = 0; i < n; i++) {
+	bin_varint(&r, bin_name_index(attrs[i * 2], true));
+	bin_value(&r, attrs[(i * 2) + 1]);
+    }
+    bin_record(leaf? BinLeaf: BinPush, &r);
+    vb_free(&r);
+
+    if (toggled(TRACING)) {
+	vb_init(&r);
+	vb_appendf(&r, "ui> %*s<%s", ui_depth, "", name);
+	for (i = 0; i < n; i++) {
+	    vb_appendf(&r, " %s=\"%s\"", attrs[i * 2], attrs[(i * 2) + 1]);
+	}
+	vtrace("%s%s>\n", vb_buf(&r), leaf? "/": "");
+	vb_free(&r);
     }
 }
 
@@ -236,15 +546,25 @@ ui_object(bool leaf, const char *name, const char *args[])
     const char *tag;
     int i = 0;
 
+    if (ui_binary) {
+	unsigned n = 0;
+
+	while (args[n * 2] != NULL) {
+	    n++;
+	}
+	bin_object(leaf, name, args, n);
+	return;
+    }
+
     uprintf("%*s<%s", ui_depth, "", name);
     while ((tag = args[i++]) != NULL) {
 	const char *value = args[i++];
 
 	uprintf(" %s=\"", tag);
 	xml_safe(value);
-	uprintf("\"");
+	uputs("\"", 1);
     }
-    uprintf("%s>\n", leaf? "/": "");
+    uputs(leaf? "/>\n": ">\n", leaf? 3: 2);
 }
 
 /*
@@ -256,6 +576,30 @@ ui_vobject(bool leaf, const char *name, va_list ap)
 {
     const char *tag;
 
+    if (ui_binary) {
+	static const char **attrs = NULL;
+	static unsigned attrs_size = 0;
+	unsigned n = 0;
+
+	while ((tag = va_arg(ap, const char *)) != NULL) {
+	    const char *value = va_arg(ap, const char *);
+
+	    if (value == NULL) {
+		continue;
+	    }
+	    if ((n + 1) * 2 > attrs_size) {
+		attrs_size = attrs_size? attrs_size * 2: 32;
+		attrs = (const char **)Realloc((void *)attrs,
+			attrs_size * sizeof(const char *));
+	    }
+	    attrs[n * 2] = tag;
+	    attrs[(n * 2) + 1] = value;
+	    n++;
+	}
+	bin_object(leaf, name, attrs, n);
+	return;
+    }
+
     uprintf("%*s<%s", ui_depth, "", name);
     while ((tag = va_arg(ap, const char *)) != NULL) {
 	const char *value = va_arg(ap, const char *);
@@ -263,10 +607,10 @@ ui_vobject(bool leaf, const char *name, va_list ap)
 	if (value) {
 	    uprintf(" %s=\"", tag);
 	    xml_safe(value);
-	    uprintf("\"");
+	    uputs("\"", 1);
 	}
     }
-    uprintf("%s>\n", leaf? "/": "");
+    uputs(leaf? "/>\n": ">\n", leaf? 3: 2);
 }
 
 /*
@@ -346,7 +690,12 @@ ui_pop(void)
     ui_container_t *g = ui_container;
 
     ui_depth--;
-    uprintf("%*s</%s>\n", ui_depth, "", g->name);
+    if (ui_binary) {
+	bin_record(BinPop, NULL);
+	vtrace("ui> %*s</%s>\n", ui_depth, "", g->name);
+    } else {
+	uprintf("%*s</%s>\n", ui_depth, "", g->name);
+    }
     ui_container = g->next;
     Free(g);
 }
@@ -766,6 +1115,7 @@ ui_exiting(bool ignored)
     while (ui_container) {
 	ui_pop();
     }
+    ui_write(true);
 }
 
 /**
@@ -937,9 +1287,14 @@ ui_io_init()
     }
 #endif /*]*/
 
-    /* Start the XML stream. */
-    uprintf("%c%c%c<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n",
-	    0xef, 0xbb, 0xbf);
+    /* Start the output stream. */
+    ui_binary = appres.scripting.ui_binary;
+    if (ui_binary) {
+	uputs(BinMagic, BinMagicLen);
+    } else {
+	uprintf("%c%c%c<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n",
+		0xef, 0xbb, 0xbf);
+    }
     ui_vpush(DocOut, NULL);
 
     /* Set up a handler for exit. */
@@ -0,0 +1,1108 @@
+/*
+ * Copyright (c) 2020 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Paul Mattes nor his contributors may be used
+ *       to endorse or promote products derived from this software without
+ *       specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	bench3270.c
+ *		Offline data stream benchmark.
+ *
+ * Links the s3270 protocol core and feeds it the host side of recorded
+ * sessions (binary trace files), without a host. Each stream is run two
+ * ways: through net_process_input(), which is everything net_input() does
+ * after the socket read (telnet_fsm, process_ds, ctlr, sf, nvt), and
+ * straight into process_ds() or nvt_process(), which leaves out the TELNET
+ * layer. After each record, the screen is rendered as HTML, which is what
+ * the s3270 PrintText() action does. The net_process_input() pass is also
+ * run with its IAC-scan fast path turned off, which feeds every byte
+ * through telnet_fsm().
+ *
+ * Then a few conversion kernels are compared against the per-character
+ * code they replaced, on EBCDIC text taken from the streams:
+ *  e2mb   ebcdic_to_multibyte_string(), against ebcdic_to_unicode() plus
+ *         unicode_to_multibyte() for each character
+ *  ascii  the per-cell conversion Ascii() does in dump_range(), against the
+ *         same per-character conversion and one vb_appendf() per byte
+ *  u2e    multibyte_to_ebcdic_string(), against multibyte_to_unicode() plus
+ *         a linear search of the code page for each character
+ *
+ * The emulator is connected to a loopback socket so that its replies have
+ * somewhere to go, but no data is read from it.
+ */
+
+#include "globals.h"
+#include <signal.h>
+#include <fcntl.h>
+#include <time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#if defined(__linux__) /*[*/
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <linux/perf_event.h>
+#endif /*]*/
+#include "appres.h"
+#include "3270ds.h"
+#include "arpa_telnet.h"
+#include "bintrace.h"
+#include "tn3270e.h"
+#include "resources.h"
+
+#include "actions.h"
+#include "codepage.h"
+#include "ctlrc.h"
+#include "fprint_screen.h"
+#include "ft.h"
+#include "glue.h"
+#include "host.h"
+#include "httpd-core.h"
+#include "httpd-io.h"
+#include "httpd-nodes.h"
+#include "idle.h"
+#include "kybd.h"
+#include "lazya.h"
+#include "login_macro.h"
+#include "model.h"
+#include "nvt.h"
+#include "opts.h"
+#include "popups.h"
+#include "print_screen.h"
+#include "product.h"
+#include "proxy_toggle.h"
+#include "query.h"
+#include "screen.h"
+#include "sio_glue.h"
+#include "task.h"
+#include "telnet.h"
+#include "toggles.h"
+#include "trace.h"
+#include "screentrace.h"
+#include "unicodec.h"
+#include "utils.h"
+#include "varbuf.h"
+#include "xio.h"
+
+#define DEFAULT_ITERATIONS	5
+#define CONNECT_LOOPS		1000	/* limit on process_events() calls */
+#define KERNEL_BYTES		(4 * 1024 * 1024)	/* large kernel input */
+#define KERNEL_SCREEN		(24 * 80)		/* screen-sized input */
+
+/* One host record. */
+typedef struct {
+    unsigned char *net;		/* as received */
+    size_t net_len;
+    unsigned char *ds;		/* 3270 record or NVT text, unescaped */
+    size_t ds_len;
+    bool eor;			/* ds is a 3270 record */
+    bool telnet;		/* has TELNET commands, must go through net */
+} brec_t;
+
+/* One stream. */
+typedef struct {
+    char *name;
+    char *path;
+    char *codepage;		/* code page to use, or NULL */
+    bool transfer;		/* start an IND$FILE transfer */
+    brec_t *recs;
+    unsigned nrecs;
+    size_t bytes;
+} stream_t;
+
+/* Results of one pass through a stream. */
+typedef struct {
+    uint64_t ns;		/* time in the core */
+    uint64_t allocs;		/* allocator calls */
+    uint64_t misses;		/* cache misses */
+    uint64_t render_ns;		/* time rendering */
+    unsigned renders;		/* number of renders */
+} pass_t;
+
+static stream_t *streams;
+static unsigned nstreams;
+static socket_t listen_s = INVALID_SOCKET;
+static unsigned short listen_port;
+static socket_t host_s = INVALID_SOCKET;
+static FILE *render_file;
+
+/* Totals for the TELNET input comparison. */
+static uint64_t telnet_bytes;
+static uint64_t telnet_bulk_ns;
+static uint64_t telnet_bytewise_ns;
+
+static void bench_register(void);
+
+/* Allocation counting. */
+static uint64_t n_allocs;
+#if defined(__GLIBC__) /*[*/
+# define COUNT_ALLOCS	1
+extern void *__libc_malloc(size_t);
+extern void *__libc_calloc(size_t, size_t);
+extern void *__libc_realloc(void *, size_t);
+extern void __libc_free(void *);
+
+void *
+malloc(size_t size)
+{
+    n_allocs++;
+    return __libc_malloc(size);
+}
+
+void *
+calloc(size_t nmemb, size_t size)
+{
+    n_allocs++;
+    return __libc_calloc(nmemb, size);
+}
+
+void *
+realloc(void *ptr, size_t size)
+{
+    n_allocs++;
+    return __libc_realloc(ptr, size);
+}
+
+void
+free(void *ptr)
+{
+    __libc_free(ptr);
+}
+#else /*][*/
+# define COUNT_ALLOCS	0
+#endif /*]*/
+
+/* Cache miss counting, if the kernel allows it. */
+static int perf_fd = -1;
+
+static void
+perf_init(void)
+{
+#if defined(__linux__) /*[*/
+    struct perf_event_attr pe;
+
+    memset(&pe, 0, sizeof(pe));
+    pe.type = PERF_TYPE_HARDWARE;
+    pe.size = sizeof(pe);
+    pe.config = PERF_COUNT_HW_CACHE_MISSES;
+    pe.disabled = 1;
+    pe.exclude_kernel = 1;
+    pe.exclude_hv = 1;
+    perf_fd = (int)syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
+#endif /*]*/
+}
+
+static void
+perf_start(void)
+{
+#if defined(__linux__) /*[*/
+    if (perf_fd >= 0) {
+	ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif /*]*/
+}
+
+static void
+perf_stop(void)
+{
+#if defined(__linux__) /*[*/
+    if (perf_fd >= 0) {
+	ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+#endif /*]*/
+}
+
+static uint64_t
+perf_read(void)
+{
+    uint64_t count = 0;
+
+#if defined(__linux__) /*[*/
+    if (perf_fd >= 0) {
+	if (read(perf_fd, &count, sizeof(count)) != sizeof(count)) {
+	    count = 0;
+	}
+	ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+    }
+#endif /*]*/
+    return count;
+}
+
+static uint64_t
+now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+void
+usage(const char *msg)
+{
+    if (msg != NULL) {
+	fprintf(stderr, "%s\n", msg);
+    }
+    fprintf(stderr, "Usage: bench3270 [-i iterations] [-s stream] [options] "
+	    "corpus|trace-file\n");
+    fprintf(stderr, "Use " OptHelp1 " for the list of options\n");
+    exit(1);
+}
+
+/*
+ * Split out the data from a host record, for feeding to process_ds() or
+ * nvt_process(). Records with TELNET commands other than a final EOR are
+ * left to the TELNET layer.
+ */
+static void
+decode_record(brec_t *r)
+{
+    size_t i;
+    unsigned char *d;
+
+    r->ds = d = Malloc(r->net_len);
+    r->eor = false;
+    r->telnet = false;
+    for (i = 0; i < r->net_len; i++) {
+	if (r->net[i] != IAC) {
+	    *d++ = r->net[i];
+	    continue;
+	}
+	if (i + 1 < r->net_len && r->net[i + 1] == IAC) {
+	    *d++ = IAC;
+	    i++;
+	} else if (i + 2 == r->net_len && r->net[i + 1] == EOR) {
+	    r->eor = true;
+	    break;
+	} else {
+	    r->telnet = true;
+	    break;
+	}
+    }
+    r->ds_len = d - r->ds;
+}
+
+/* Read the host records from a binary trace file. */
+static bool
+read_stream(stream_t *s)
+{
+    FILE *f;
+    btrace_t bt;
+    int rv;
+
+    if ((f = fopen(s->path, "rb")) == NULL) {
+	perror(s->path);
+	return false;
+    }
+    if (!bt_open(&bt, f)) {
+	fprintf(stderr, "%s: not a binary trace file\n", s->path);
+	fclose(f);
+	return false;
+    }
+
+    while ((rv = bt_read(&bt)) > 0) {
+	brec_t *r;
+
+	if (bt.type != BT_NET_IN || bt.len == 0) {
+	    continue;
+	}
+	s->recs = Realloc(s->recs, (s->nrecs + 1) * sizeof(brec_t));
+	r = &s->recs[s->nrecs++];
+	r->net = Malloc(bt.len);
+	memcpy(r->net, bt.data, bt.len);
+	r->net_len = bt.len;
+	decode_record(r);
+	s->bytes += bt.len;
+    }
+    if (rv < 0) {
+	fprintf(stderr, "%s: truncated record\n", s->path);
+    }
+    fclose(f);
+    free(bt.data);
+    if (s->nrecs == 0) {
+	fprintf(stderr, "%s: no host data\n", s->path);
+	return false;
+    }
+    return true;
+}
+
+/* Add a stream. */
+static void
+add_stream(const char *path, const char *name, const char *codepage,
+	bool transfer)
+{
+    stream_t *s;
+
+    streams = Realloc(streams, (nstreams + 1) * sizeof(stream_t));
+    s = &streams[nstreams++];
+    memset(s, 0, sizeof(stream_t));
+    s->path = NewString(path);
+    s->name = NewString(name);
+    s->codepage = codepage? NewString(codepage): NULL;
+    s->transfer = transfer;
+}
+
+/*
+ * Read the corpus, which is either a single binary trace file, or a list of
+ * them. Each line of the list is a file name, relative to the list, and
+ * optional settings:
+ *  codepage=name	use a different host code page
+ *  transfer		start an IND$FILE receive when the keyboard unlocks
+ */
+static bool
+read_corpus(const char *path, const char *only)
+{
+    FILE *f;
+    char buf[1024];
+    char *dir;
+    char *slash;
+
+    if ((f = fopen(path, "r")) == NULL) {
+	perror(path);
+	return false;
+    }
+    if (fread(buf, BT_MAGIC_LEN, 1, f) == 1 &&
+	    !memcmp(buf, BT_MAGIC, BT_MAGIC_LEN)) {
+	const char *base = strrchr(path, '/');
+
+	fclose(f);
+	add_stream(path, base? base + 1: path, NULL, false);
+	return true;
+    }
+    rewind(f);
+
+    dir = NewString(path);
+    if ((slash = strrchr(dir, '/')) != NULL) {
+	*(slash + 1) = '\0';
+    } else {
+	*dir = '\0';
+    }
+
+    while (fgets(buf, sizeof(buf), f) != NULL) {
+	char *file, *word, *saveptr;
+	char *name;
+	char *dot;
+	const char *codepage = NULL;
+	bool transfer = false;
+
+	if ((file = strtok_r(buf, " \t\r\n", &saveptr)) == NULL ||
+		*file == '#') {
+	    continue;
+	}
+	while ((word = strtok_r(NULL, " \t\r\n", &saveptr)) != NULL) {
+	    if (!strncmp(word, "codepage=", 9)) {
+		codepage = word + 9;
+	    } else if (!strcmp(word, "transfer")) {
+		transfer = true;
+	    } else {
+		fprintf(stderr, "%s: unknown setting '%s'\n", path, word);
+	    }
+	}
+	name = NewString(file);
+	if ((dot = strrchr(name, '.')) != NULL) {
+	    *dot = '\0';
+	}
+	if (only == NULL || !strcmp(name, only)) {
+	    add_stream(lazyaf("%s%s", dir, file), name, codepage, transfer);
+	}
+	Free(name);
+    }
+    fclose(f);
+    Free(dir);
+
+    if (nstreams == 0) {
+	fprintf(stderr, "%s: no streams\n", path);
+	return false;
+    }
+    return true;
+}
+
+/* Set up the socket the emulator connects to. */
+static void
+listen_init(void)
+{
+    struct sockaddr_in sin;
+    socklen_t len = sizeof(sin);
+
+    memset(&sin, 0, sizeof(sin));
+    sin.sin_family = AF_INET;
+    sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if ((listen_s = socket(AF_INET, SOCK_STREAM, 0)) == INVALID_SOCKET ||
+	    bind(listen_s, (struct sockaddr *)&sin, sizeof(sin)) < 0 ||
+	    listen(listen_s, 1) < 0 ||
+	    getsockname(listen_s, (struct sockaddr *)&sin, &len) < 0 ||
+	    fcntl(listen_s, F_SETFL, O_NONBLOCK) < 0) {
+	perror("listen socket");
+	exit(1);
+    }
+    listen_port = ntohs(sin.sin_port);
+}
+
+/* Discard whatever the emulator has sent. */
+static void
+drain(void)
+{
+    char buf[4096];
+
+    while (recv(host_s, buf, sizeof(buf), MSG_DONTWAIT) > 0) {
+    }
+}
+
+/* Connect the emulator. */
+static bool
+bench_connect(void)
+{
+    int i;
+
+    if (!host_connect(lazyaf("127.0.0.1:%u", listen_port), IA_UI)) {
+	return false;
+    }
+    for (i = 0; i < CONNECT_LOOPS; i++) {
+	if (host_s == INVALID_SOCKET) {
+	    host_s = accept(listen_s, NULL, NULL);
+	}
+	if (cstate != TELNET_PENDING) {
+	    process_events(true);
+	} else if (host_s != INVALID_SOCKET) {
+	    break;
+	}
+    }
+    return host_s != INVALID_SOCKET && cstate == TELNET_PENDING;
+}
+
+/* Disconnect the emulator. */
+static void
+bench_disconnect(void)
+{
+    int i;
+
+    host_disconnect(false);
+    for (i = 0; i < CONNECT_LOOPS && PCONNECTED; i++) {
+	process_events(false);
+    }
+    if (host_s != INVALID_SOCKET) {
+	SOCK_CLOSE(host_s);
+	host_s = INVALID_SOCKET;
+    }
+}
+
+/* Start a file transfer, as if the user had typed it at the READY prompt. */
+static bool
+start_transfer(void)
+{
+    int i;
+
+    push_macro("Transfer(Direction=receive,HostFile=bench,"
+	    "LocalFile=/dev/null,Exist=replace)");
+    for (i = 0; i < CONNECT_LOOPS && ft_state == FT_NONE; i++) {
+	process_events(false);
+    }
+    return ft_state != FT_NONE;
+}
+
+/* Render the screen. */
+static void
+render(pass_t *p)
+{
+    uint64_t t0 = now_ns();
+
+    fprint_screen(render_file, P_HTML, FPS_EVEN_IF_EMPTY | FPS_NO_HEADER,
+	    NULL, NULL, NULL);
+    p->render_ns += now_ns() - t0;
+    p->renders++;
+}
+
+/*
+ * Run one pass through a stream.
+ * If 'direct' is true, data is fed to process_ds() or nvt_process().
+ */
+static bool
+run_pass(stream_t *s, bool direct, pass_t *p)
+{
+    unsigned i;
+    bool transfer_started = false;
+    bool ok = true;
+
+    memset(p, 0, sizeof(pass_t));
+    if (!bench_connect()) {
+	fprintf(stderr, "%s: cannot connect\n", s->name);
+	bench_disconnect();
+	return false;
+    }
+
+    for (i = 0; i < s->nrecs; i++) {
+	brec_t *r = &s->recs[i];
+	uint64_t t0, allocs0;
+
+	if (s->transfer && !transfer_started && IN_3270 && !kybdlock) {
+	    if (!start_transfer()) {
+		fprintf(stderr, "%s: transfer did not start\n", s->name);
+		ok = false;
+		break;
+	    }
+	    transfer_started = true;
+	    drain();
+	}
+
+	perf_start();
+	allocs0 = n_allocs;
+	t0 = now_ns();
+	if (!direct || r->telnet || !(IN_3270 || IN_NVT)) {
+	    if (!net_process_input(r->net, r->net_len)) {
+		ok = false;
+	    }
+	} else if (r->eor) {
+	    size_t skip = IN_E? EH_SIZE: 0;
+
+	    if (r->ds_len > skip) {
+		process_ds(r->ds + skip, r->ds_len - skip);
+	    }
+	} else {
+	    size_t j;
+
+	    for (j = 0; j < r->ds_len; j++) {
+		nvt_process(r->ds[j]);
+	    }
+	}
+	p->ns += now_ns() - t0;
+	p->allocs += n_allocs - allocs0;
+	perf_stop();
+
+	if (!ok) {
+	    fprintf(stderr, "%s: host connection dropped at record %u\n",
+		    s->name, i);
+	    break;
+	}
+
+	drain();
+	process_events(false);
+	if (!direct) {
+	    render(p);
+	}
+    }
+
+    p->misses = perf_read();
+    if (s->transfer && ft_state != FT_NONE) {
+	fprintf(stderr, "%s: transfer did not complete\n", s->name);
+	ok = false;
+    }
+    bench_disconnect();
+    return ok;
+}
+
+/* Run a stream and report the results. */
+static void
+run_stream(stream_t *s, int iterations)
+{
+    pass_t p;
+    uint64_t net_best = 0, bytewise_best = 0, ds_best = 0;
+    uint64_t allocs = 0, misses = 0, render_ns = 0;
+    unsigned renders = 0;
+    int i;
+
+    if (s->codepage != NULL) {
+	if (codepage_init(s->codepage) != CS_OKAY) {
+	    fprintf(stderr, "%s: cannot find code page \"%s\"\n", s->name,
+		    s->codepage);
+	    return;
+	}
+	st_changed(ST_CODEPAGE, true);
+    }
+
+    for (i = 0; i < iterations; i++) {
+	if (!run_pass(s, false, &p)) {
+	    break;
+	}
+	if (i == 0 || p.ns < net_best) {
+	    net_best = p.ns;
+	}
+	allocs += p.allocs;
+	misses += p.misses;
+	render_ns += p.render_ns;
+	renders += p.renders;
+
+	net_bulk_input = false;
+	if (!run_pass(s, false, &p)) {
+	    net_bulk_input = true;
+	    break;
+	}
+	net_bulk_input = true;
+	if (i == 0 || p.ns < bytewise_best) {
+	    bytewise_best = p.ns;
+	}
+
+	if (!run_pass(s, true, &p)) {
+	    break;
+	}
+	if (i == 0 || p.ns < ds_best) {
+	    ds_best = p.ns;
+	}
+    }
+
+    if (s->codepage != NULL) {
+	codepage_init(appres.codepage);
+	st_changed(ST_CODEPAGE, true);
+    }
+
+    if (i < iterations) {
+	printf("%-12s failed\n", s->name);
+	return;
+    }
+    telnet_bytes += s->bytes;
+    telnet_bulk_ns += net_best;
+    telnet_bytewise_ns += bytewise_best;
+    printf("%-12s %9lu %7u %8.2f %8.2f %8.2f", s->name,
+	    (unsigned long)s->bytes, s->nrecs, (double)net_best / s->bytes,
+	    (double)bytewise_best / s->bytes, (double)ds_best / s->bytes);
+    if (COUNT_ALLOCS) {
+	printf(" %10.2f", (double)allocs / iterations / s->nrecs);
+    } else {
+	printf(" %10s", "-");
+    }
+    if (perf_fd >= 0) {
+	printf(" %9.2f",
+		(double)misses / iterations / ((double)s->bytes / 1024));
+    } else {
+	printf(" %9s", "-");
+    }
+    printf(" %9.2f\n", renders? (double)render_ns / renders / 1000: 0.0);
+}
+
+/*
+ * Conversion kernels.
+ *
+ * Each one is run over its input enough times to cover KERNEL_BYTES, and
+ * returns a value that depends on its output, so the old and new versions
+ * can be checked against each other.
+ */
+typedef size_t kernel_t(const void *in, size_t len);
+
+static unsigned char *k_ebc;		/* EBCDIC text */
+static struct ea *k_ea;			/* the same, as a screen */
+static char *k_mb;			/* the same, in the local encoding */
+static size_t k_mb_len;
+static size_t k_mb_screen_len;		/* length of the first screen of k_mb */
+static char *k_out;			/* output buffer */
+static size_t k_out_len;
+static ucs4_t k_code[0xff - 0x41];	/* code page, for the linear search */
+
+/* EBCDIC to multibyte, as a string. */
+static size_t
+e2mb_new(const void *in, size_t len)
+{
+    return ebcdic_to_multibyte_string((unsigned char *)in, len, k_out,
+	    k_out_len);
+}
+
+/* EBCDIC to multibyte, one character at a time. */
+static size_t
+e2mb_old(const void *in, size_t len)
+{
+    const unsigned char *ebc = in;
+    char *mb = k_out;
+    size_t left = k_out_len;
+    size_t i;
+
+    for (i = 0; i < len && left; i++) {
+	ucs4_t uc = ebcdic_to_unicode(ebc[i], CS_BASE, EUO_BLANK_UNDEF);
+	int xlen = unicode_to_multibyte(uc, mb, left);
+
+	if (xlen > 1) {
+	    mb += xlen - 1;
+	    left -= xlen - 1;
+	}
+    }
+    return mb - k_out;
+}
+
+/* Ascii() conversion of a screen. */
+static size_t
+ascii_new(const void *in, size_t len)
+{
+    const struct ea *ea = in;
+    varbuf_t r;
+    size_t i;
+    size_t rv;
+
+    vb_init(&r);
+    for (i = 0; i < len; i++) {
+	char mb[16];
+	ucs4_t uc;
+	size_t xlen;
+
+	xlen = ebcdic_to_multibyte_fx(ea[i].ec, ea[i].cs, mb, sizeof(mb),
+		EUO_BLANK_UNDEF, &uc, false);
+	if (xlen > 1) {
+	    vb_append(&r, mb, xlen - 1);
+	}
+    }
+    rv = vb_len(&r);
+    vb_free(&r);
+    return rv;
+}
+
+/* Ascii() conversion of a screen, one byte at a time. */
+static size_t
+ascii_old(const void *in, size_t len)
+{
+    const struct ea *ea = in;
+    varbuf_t r;
+    size_t i;
+    size_t rv;
+
+    vb_init(&r);
+    for (i = 0; i < len; i++) {
+	char mb[16];
+	ucs4_t uc = ebcdic_to_unicode(ea[i].ec, ea[i].cs, EUO_BLANK_UNDEF);
+	int xlen = unicode_to_multibyte(uc, mb, sizeof(mb));
+	int j;
+
+	for (j = 0; j < xlen - 1; j++) {
+	    vb_appendf(&r, "%c", mb[j]);
+	}
+    }
+    rv = vb_len(&r);
+    vb_free(&r);
+    return rv;
+}
+
+/* Multibyte to EBCDIC, as a string. */
+static size_t
+u2e_new(const void *in, size_t len)
+{
+    enum me_fail error;
+    int ne;
+
+    ne = multibyte_to_ebcdic_string((char *)in, len, (unsigned char *)k_out,
+	    k_out_len, &error);
+    return (ne < 0)? 0: (size_t)ne;
+}
+
+/* Multibyte to EBCDIC, searching the code page for each character. */
+static size_t
+u2e_old(const void *in, size_t len)
+{
+    const char *mb = in;
+    unsigned char *ebc = (unsigned char *)k_out;
+    size_t left = k_out_len;
+
+    while (len > 0 && left > 0) {
+	enum me_fail error;
+	int consumed;
+	ucs4_t u = multibyte_to_unicode(mb, len, &consumed, &error);
+	ebc_t e = 0;
+	size_t i;
+
+	if (u == 0) {
+	    return 0;
+	}
+	if (u == 0x0020) {
+	    e = 0x40;
+	} else {
+	    for (i = 0; i < sizeof(k_code) / sizeof(k_code[0]); i++) {
+		if (k_code[i] == u) {
+		    e = 0x41 + i;
+		    break;
+		}
+	    }
+	}
+	if (e == 0) {
+	    return 0;
+	}
+	*ebc++ = e;
+	left--;
+	mb += consumed;
+	len -= consumed;
+    }
+    return ebc - (unsigned char *)k_out;
+}
+
+/* Time a kernel, best of 'iterations' runs. */
+static uint64_t
+time_kernel(kernel_t *fn, const void *in, size_t len, size_t bytes,
+	int iterations, size_t *result)
+{
+    size_t reps = (KERNEL_BYTES + bytes - 1) / bytes;
+    uint64_t best = 0;
+    int i;
+
+    for (i = 0; i < iterations; i++) {
+	uint64_t t0 = now_ns();
+	uint64_t t;
+	size_t j;
+
+	for (j = 0; j < reps; j++) {
+	    *result = (*fn)(in, len);
+	}
+	t = (now_ns() - t0) / reps;
+	if (i == 0 || t < best) {
+	    best = t;
+	}
+    }
+    return best;
+}
+
+/* Report one comparison. */
+static void
+kernel_report(const char *name, const char *input, size_t bytes,
+	uint64_t old_ns, uint64_t new_ns, bool match)
+{
+    printf("%-12s %-7s %9lu %9.1f %9.1f %7.2f%s\n", name, input,
+	    (unsigned long)bytes,
+	    old_ns? (double)bytes * 1000 / old_ns: 0.0,
+	    new_ns? (double)bytes * 1000 / new_ns: 0.0,
+	    new_ns? (double)old_ns / new_ns: 0.0,
+	    match? "": "  (outputs differ)");
+}
+
+/* Compare an old and a new kernel. */
+static void
+kernel_compare(const char *name, const char *input, kernel_t *old_fn,
+	kernel_t *new_fn, const void *in, size_t len, size_t bytes,
+	int iterations)
+{
+    size_t old_result, new_result;
+    uint64_t old_ns, new_ns;
+
+    old_ns = time_kernel(old_fn, in, len, bytes, iterations, &old_result);
+    new_ns = time_kernel(new_fn, in, len, bytes, iterations, &new_result);
+    kernel_report(name, input, bytes, old_ns, new_ns,
+	    old_result == new_result);
+}
+
+/*
+ * Build the kernel inputs: the printable EBCDIC bytes of the 3270 records
+ * in the streams, repeated out to KERNEL_BYTES.
+ */
+static void
+kernel_init(void)
+{
+    size_t n = 0;
+    unsigned i, j;
+    size_t k;
+
+    k_ebc = Malloc(KERNEL_BYTES);
+    for (i = 0; i < nstreams && n < KERNEL_BYTES; i++) {
+	if (streams[i].codepage != NULL) {
+	    continue;
+	}
+	for (j = 0; j < streams[i].nrecs && n < KERNEL_BYTES; j++) {
+	    brec_t *r = &streams[i].recs[j];
+
+	    if (!r->eor) {
+		continue;
+	    }
+	    for (k = 0; k < r->ds_len && n < KERNEL_BYTES; k++) {
+		if (r->ds[k] >= 0x40 && r->ds[k] < 0xff) {
+		    k_ebc[n++] = r->ds[k];
+		}
+	    }
+	}
+    }
+    if (n == 0) {
+	/* No 3270 text; use the whole code page. */
+	for (; n < 0xff - 0x40; n++) {
+	    k_ebc[n] = 0x40 + n;
+	}
+    }
+    for (k = n; k < KERNEL_BYTES; k++) {
+	k_ebc[k] = k_ebc[k % n];
+    }
+
+    k_ea = Calloc(KERNEL_SCREEN, sizeof(struct ea));
+    for (k = 0; k < KERNEL_SCREEN; k++) {
+	k_ea[k].ec = k_ebc[k];
+    }
+
+    k_out_len = mb_max_len(KERNEL_BYTES);
+    k_out = Malloc(k_out_len);
+    k_mb_len = ebcdic_to_multibyte_string(k_ebc, KERNEL_BYTES, k_out,
+	    k_out_len);
+    k_mb = Malloc(k_mb_len);
+    memcpy(k_mb, k_out, k_mb_len);
+    k_mb_screen_len = ebcdic_to_multibyte_string(k_ebc, KERNEL_SCREEN, k_out,
+	    k_out_len);
+
+    for (k = 0; k < sizeof(k_code) / sizeof(k_code[0]); k++) {
+	k_code[k] = ebcdic_base_to_unicode(0x41 + k, EUO_NONE);
+    }
+}
+
+/* Run the kernel comparisons. */
+static void
+run_kernels(int iterations)
+{
+    kernel_init();
+
+    printf("\n%-12s %-7s %9s %9s %9s %7s\n", "kernel", "input", "bytes",
+	    "old", "new", "speedup");
+    printf("%-12s %-7s %9s %9s %9s %7s\n", "", "", "", "MB/s", "MB/s", "");
+    if (telnet_bytes) {
+	kernel_report("telnet-input", "streams", telnet_bytes,
+		telnet_bytewise_ns, telnet_bulk_ns, true);
+    }
+    kernel_compare("e2mb", "screen", e2mb_old, e2mb_new, k_ebc,
+	    KERNEL_SCREEN, KERNEL_SCREEN, iterations);
+    kernel_compare("e2mb", "4MB", e2mb_old, e2mb_new, k_ebc,
+	    KERNEL_BYTES, KERNEL_BYTES, iterations);
+    kernel_compare("ascii", "screen", ascii_old, ascii_new, k_ea,
+	    KERNEL_SCREEN, KERNEL_SCREEN, iterations);
+    kernel_compare("u2e", "screen", u2e_old, u2e_new, k_mb,
+	    k_mb_screen_len, KERNEL_SCREEN, iterations);
+    kernel_compare("u2e", "4MB", u2e_old, u2e_new, k_mb, k_mb_len,
+	    KERNEL_BYTES, iterations);
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *cl_corpus = NULL;
+    const char *only = NULL;
+    int iterations = DEFAULT_ITERATIONS;
+    unsigned i;
+
+    /* Pull off our own options. */
+    while (argc > 2 && argv[1][0] == '-' && argv[1][1] != '\0' &&
+	    strchr("is", argv[1][1]) != NULL && argv[1][2] == '\0') {
+	if (argv[1][1] == 'i') {
+	    iterations = atoi(argv[2]);
+	    if (iterations < 1) {
+		usage("Invalid -i");
+	    }
+	} else {
+	    only = argv[2];
+	}
+	argv[2] = argv[0];
+	argv += 2;
+	argc -= 2;
+    }
+
+    codepage_register();
+    ctlr_register();
+    ft_register();
+    host_register();
+    idle_register();
+    kybd_register();
+    task_register();
+    query_register();
+    nvt_register();
+    print_screen_register();
+    bench_register();
+    toggles_register();
+    trace_register();
+    screentrace_register();
+    xio_register();
+    sio_glue_register();
+    hio_register();
+    proxy_register();
+    model_register();
+    net_register();
+    login_macro_register();
+
+    argc = parse_command_line(argc, (const char **)argv, &cl_corpus);
+    if (cl_corpus == NULL) {
+	usage("Missing corpus");
+    }
+
+    if (codepage_init(appres.codepage) != CS_OKAY) {
+	xs_warning("Cannot find code page \"%s\"", appres.codepage);
+	codepage_init(NULL);
+    }
+    model_init();
+    ctlr_init(ALL_CHANGE);
+    ctlr_reinit(ALL_CHANGE);
+    idle_init();
+    httpd_objects_init();
+    ft_init();
+    hostfile_init();
+    signal(SIGPIPE, SIG_IGN);
+    initialize_toggles();
+
+    if (!read_corpus(cl_corpus, only)) {
+	exit(1);
+    }
+    for (i = 0; i < nstreams; i++) {
+	if (!read_stream(&streams[i])) {
+	    exit(1);
+	}
+    }
+    if ((render_file = fopen("/dev/null", "w")) == NULL) {
+	perror("/dev/null");
+	exit(1);
+    }
+    listen_init();
+    perf_init();
+
+    printf("%-12s %9s %7s %8s %8s %8s %10s %9s %9s\n", "stream", "bytes",
+	    "records", "net", "bytewise", "ds", "allocs", "misses", "render");
+    printf("%-12s %9s %7s %8s %8s %8s %10s %9s %9s\n", "", "", "",
+	    "ns/byte", "ns/byte", "ns/byte", "/record", "/KB", "us");
+    for (i = 0; i < nstreams; i++) {
+	run_stream(&streams[i], iterations);
+	fflush(stdout);
+    }
+
+    run_kernels(iterations);
+    return 0;
+}
+
+/**
+ * Set product-specific appres defaults.
+ */
+void
+product_set_appres_defaults(void)
+{
+    appres.scripted = true;
+    appres.oerr_lock = true;
+}
+
+bool
+model_can_change(void)
+{
+    return true;
+}
+
+void
+screen_init(void)
+{
+}
+
+static void
+bench_connect_change(bool ignored)
+{
+    if (CONNECTED || appres.disconnect_clear) {
+	ctlr_erase(true);
+    }
+}
+
+/**
+ * Main module registration.
+ */
+static void
+bench_register(void)
+{
+    register_schange(ST_CONNECT, bench_connect_change);
+    register_schange(ST_3270_MODE, bench_connect_change);
+}
@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2020 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Paul Mattes nor his contributors may be used
+ *       to endorse or promote products derived from this software without
+ *       specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	bintrace.c
+ *		Binary trace file support: LEB128 varints and little-endian
+ *		64-bit values, and a binary trace file reader.
+ *
+ * The varint helpers are also used by the scrollback buffer and the b3270
+ * binary protocol. This module is linked into lib3270, and is also built
+ * by the standalone tools in Playback, so it does not use globals.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "bintrace.h"
+
+/* An entry from an index record. */
+typedef struct {
+    uint64_t record;
+    uint64_t time;
+    uint64_t offset;
+} bt_index_t;
+
+/* Fetch a little-endian 64-bit value. */
+uint64_t
+bt_get64(const unsigned char *p)
+{
+    uint64_t v = 0;
+    int i;
+
+    for (i = 7; i >= 0; i--) {
+	v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+/* Store a little-endian 64-bit value. Returns the next byte. */
+unsigned char *
+bt_put64(unsigned char *p, uint64_t v)
+{
+    int i;
+
+    for (i = 0; i < 8; i++) {
+	*p++ = (unsigned char)(v >> (i * 8));
+    }
+    return p;
+}
+
+/*
+ * Store a varint, which takes up to VARINT_MAX bytes. Returns the next
+ * byte.
+ */
+unsigned char *
+varint_put(unsigned char *p, uint64_t v)
+{
+    do {
+	unsigned char c = v & 0x7f;
+
+	v >>= 7;
+	if (v) {
+	    c |= 0x80;
+	}
+	*p++ = c;
+    } while (v);
+    return p;
+}
+
+/*
+ * Fetch a varint from the bytes between *pp and end, and advance *pp past
+ * it. Returns 0 for success, -1 if it is truncated or too long.
+ */
+int
+varint_get(const unsigned char **pp, const unsigned char *end, uint64_t *vp)
+{
+    const unsigned char *p = *pp;
+    uint64_t v = 0;
+    int shift = 0;
+
+    while (p < end && shift < 64) {
+	v |= (uint64_t)(*p & 0x7f) << shift;
+	if (!(*p++ & 0x80)) {
+	    *pp = p;
+	    *vp = v;
+	    return 0;
+	}
+	shift += 7;
+    }
+    return -1;
+}
+
+/* Read a varint from the file. Returns 0 for success, -1 for EOF. */
+static int
+fget_varint(FILE *f, uint64_t *vp)
+{
+    unsigned char buf[VARINT_MAX];
+    const unsigned char *p = buf;
+    size_t len = 0;
+    int c;
+
+    do {
+	if (len >= sizeof(buf) || (c = fgetc(f)) == EOF) {
+	    return -1;
+	}
+	buf[len++] = (unsigned char)c;
+    } while (c & 0x80);
+    return varint_get(&p, buf + len, vp);
+}
+
+/*
+ * Check for a binary trace file and read its header.
+ * Returns 1 if it is one, 0 if not (leaving the file rewound).
+ */
+int
+bt_open(btrace_t *b, FILE *f)
+{
+    unsigned char buf[BT_HEADER_SIZE];
+
+    memset(b, 0, sizeof(*b));
+    b->f = f;
+    if (fread(buf, sizeof(buf), 1, f) != 1 ||
+	    memcmp(buf, BT_MAGIC, BT_MAGIC_LEN) ||
+	    buf[BT_MAGIC_LEN] != BT_VERSION) {
+	rewind(f);
+	return 0;
+    }
+    b->start = bt_get64(buf + BT_MAGIC_LEN + 1);
+    return 1;
+}
+
+/* Go back to the first record. */
+void
+bt_rewind(btrace_t *b)
+{
+    fseek(b->f, BT_HEADER_SIZE, SEEK_SET);
+    b->time = 0;
+    b->next_record = 0;
+    b->pending = 0;
+    b->rebase = 0;
+}
+
+/*
+ * Read the next record.
+ * Returns 1 for success, 0 for EOF, -1 for a malformed file.
+ */
+int
+bt_read(btrace_t *b)
+{
+    uint64_t len, delta;
+    int c;
+
+    if (b->pending) {
+	b->pending = 0;
+	return 1;
+    }
+
+    b->offset = ftell(b->f);
+    if ((c = fgetc(b->f)) == EOF) {
+	return 0;
+    }
+    if (fget_varint(b->f, &len) < 0 || fget_varint(b->f, &delta) < 0) {
+	return -1;
+    }
+    if (len >= b->alloc) {
+	b->alloc = (size_t)len + 1;
+	b->data = realloc(b->data, b->alloc);
+	if (b->data == NULL) {
+	    perror("realloc");
+	    exit(1);
+	}
+    }
+    if (len && fread(b->data, (size_t)len, 1, b->f) != 1) {
+	return -1;
+    }
+    b->data[len] = '\0';
+    b->type = c;
+    b->len = (size_t)len;
+    if (b->rebase) {
+	b->rebase = 0;
+    } else {
+	b->time += delta;
+    }
+    if (c != BT_INDEX && c != BT_TRAILER) {
+	b->record = b->next_record++;
+    }
+    return 1;
+}
+
+/*
+ * Read the index, using the trailer.
+ * Returns the number of entries, oldest first, or -1 if there is no usable
+ * index.
+ */
+static int
+read_index(btrace_t *b, bt_index_t **ixp)
+{
+    unsigned char buf[BT_TRAILER_SIZE];
+    unsigned char ibuf[3 + BT_INDEX_LEN];
+    uint64_t offset;
+    bt_index_t *ix = NULL;
+    int n = 0;
+    int i;
+
+    if (fseek(b->f, -BT_TRAILER_SIZE, SEEK_END) < 0 ||
+	    fread(buf, sizeof(buf), 1, b->f) != 1 ||
+	    buf[0] != BT_TRAILER ||
+	    buf[1] != BT_TRAILER_LEN ||
+	    buf[2] != 0 ||
+	    memcmp(buf + 3 + 8, BT_TRAILER_MAGIC, BT_MAGIC_LEN)) {
+	return -1;
+    }
+
+    /* Walk the chain backwards. */
+    for (offset = bt_get64(buf + 3);
+	 offset != 0;
+	 offset = bt_get64(ibuf + 3)) {
+	/* The delta is a varint of unknown length; skip over it. */
+	if (fseek(b->f, (long)offset, SEEK_SET) < 0 ||
+		fread(ibuf, 2, 1, b->f) != 1 ||
+		ibuf[0] != BT_INDEX ||
+		ibuf[1] != BT_INDEX_LEN) {
+	    free(ix);
+	    return -1;
+	}
+	do {
+	    if (fread(ibuf + 2, 1, 1, b->f) != 1) {
+		free(ix);
+		return -1;
+	    }
+	} while (ibuf[2] & 0x80);
+	if (fread(ibuf + 3, BT_INDEX_LEN, 1, b->f) != 1) {
+	    free(ix);
+	    return -1;
+	}
+	ix = realloc(ix, (n + 1) * sizeof(bt_index_t));
+	if (ix == NULL) {
+	    perror("realloc");
+	    exit(1);
+	}
+	ix[n].record = bt_get64(ibuf + 3 + 8);
+	ix[n].time = bt_get64(ibuf + 3 + 16);
+	ix[n].offset = bt_get64(ibuf + 3 + 24);
+	n++;
+	if (bt_get64(ibuf + 3) >= offset) {
+	    /* Loop. */
+	    free(ix);
+	    return -1;
+	}
+    }
+
+    /* Reverse it. */
+    for (i = 0; i < n / 2; i++) {
+	bt_index_t t = ix[i];
+
+	ix[i] = ix[n - 1 - i];
+	ix[n - 1 - i] = t;
+    }
+    *ixp = ix;
+    return n;
+}
+
+/*
+ * Position the file at the first text or data record whose number is at least
+ * 'record' and whose time is at least 'time'. The index is used to skip
+ * directly to the right block, if the file has one.
+ * Returns 1 if there is such a record, 0 if not, -1 for a malformed file.
+ */
+int
+bt_seek(btrace_t *b, uint64_t record, uint64_t time)
+{
+    bt_index_t *ix = NULL;
+    int n;
+    int rv;
+
+    bt_rewind(b);
+    n = read_index(b, &ix);
+    if (n >= 0) {
+	int i;
+	int best = -1;
+
+	for (i = 0; i < n; i++) {
+	    if (ix[i].record <= record && ix[i].time <= time) {
+		best = i;
+	    } else {
+		break;
+	    }
+	}
+	if (best >= 0) {
+	    fseek(b->f, (long)ix[best].offset, SEEK_SET);
+	    b->next_record = ix[best].record;
+	    b->time = ix[best].time;
+	    b->rebase = 1;
+	} else {
+	    bt_rewind(b);
+	}
+	free(ix);
+    } else {
+	bt_rewind(b);
+    }
+
+    while ((rv = bt_read(b)) > 0) {
+	if (b->type != BT_INDEX && b->type != BT_TRAILER &&
+		b->record >= record && b->time >= time) {
+	    b->pending = 1;
+	    return 1;
+	}
+    }
+    return rv;
+}
+
+/* Format the timestamp of the current record, as the text trace does. */
+char *
+bt_timestamp(btrace_t *b)
+{
+    static char buf[64];
+    uint64_t t = b->start + b->time;
+    time_t secs = (time_t)(t / 1000000);
+    struct tm *tm = localtime(&secs);
+
+    sprintf(buf, "%d%02d%02d.%02d%02d%02d.%03d ",
+	    tm->tm_year + 1900,
+	    tm->tm_mon + 1,
+	    tm->tm_mday,
+	    tm->tm_hour,
+	    tm->tm_min,
+	    tm->tm_sec,
+	    (int)((t % 1000000) / 1000));
+    return buf;
+}
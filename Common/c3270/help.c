@@ -136,7 +136,8 @@ static struct {
 	    "Escape to '" HELP_W "c3270>' prompt" },
 	{ AnExecute, "<command>", P_SCRIPTING, "Execute a shell command" },
 	{ "Exit", NULL, P_INTERACTIVE, "Exit " HELP_W "c3270" },
-	{ AnExpect, "<pattern>", P_SCRIPTING, "Wait for NVT output" },
+	{ AnExpect, "<pattern>[,or,<pattern>...][,<timeout>]", P_SCRIPTING,
+	    "Wait for NVT output" },
 	{ AnFieldEnd, NULL, P_3270, "Move to end of field" },
 	{ AnFieldMark, NULL, P_3270, "3270 FIELD MARK key (X'1E')" },
 	{ AnFlip, NULL, P_3270, "Flip display left-to-right" },
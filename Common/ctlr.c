@@ -108,8 +108,50 @@ static unsigned char default_cs;
 static unsigned char default_ic;
 static void ctlr_negotiating(bool ignored);
 static void ctlr_connect(bool ignored);
+static void ctlr_codepage_changed(bool ignored);
 static int sscp_start;
 static void ctlr_add_ic(int baddr, unsigned char ic);
+static void mark_rows(int first, int last, bool spill);
+
+/* Per-row change flags, for the screen modules. */
+#define ROW_CHANGED	0x1	/* something in the row changed */
+#define ROW_SPILL	0x2	/* changes may carry into the next field */
+static unsigned char *rows_changed = NULL;
+static int rows_first = -1;	/* first changed row, or -1 */
+static int rows_last = -1;	/* last changed row, or -1 */
+static bool rows_moved = false;	/* every row must be redrawn, but none of
+				   them is marked in rows_changed */
+
+/*
+ * Per-row change serial numbers, for Wait(Text). Unlike rows_changed, these
+ * are never reset, so any number of observers can compare them against the
+ * serial they last saw. Changes that can spill into other rows, and scrolls,
+ * set all_serial instead.
+ */
+static unsigned long *rows_serial = NULL;
+static unsigned long change_serial = 0;
+static unsigned long all_serial = 0;
+static unsigned long screen_gen = 0;	/* screen generation number */
+static unsigned long gen_serial = 0;	/* change_serial it was taken at */
+static uint64_t *rows_hash = NULL;	/* per-row content hashes */
+static uint64_t screen_hash = 0;	/* whole-screen content hash */
+static unsigned long hash_serial = 0;	/* change_serial it was taken at */
+static int hash_rows = 0;		/* screen size it was taken at */
+static int hash_cols = 0;
+
+/*
+ * Field attribute index: the sorted addresses of the field attributes in
+ * ea_buf.  It is updated in place as individual attributes come and go, and
+ * rebuilt on demand after anything that moves attributes around in bulk.
+ */
+static int *fa_index = NULL;
+static int fa_count = 0;	/* number of entries in fa_index */
+static bool fa_valid = false;	/* fa_index matches ea_buf */
+static int fa_rows, fa_cols;	/* dimensions fa_index was built for */
+static void fa_index_sync(void);
+static void fa_index_insert(int baddr);
+static void fa_index_delete(int baddr);
+static bool fa_index_any(int baddr, int count);
 
 static void ticking_stop(struct timeval *tp);
 
@@ -132,13 +174,17 @@ static unsigned char code_table[64] = {
 
 #define ALL_CHANGED	{ \
 	screen_changed = true; \
+	mark_rows(0, ROWS*COLS, false); \
 	if (IN_NVT) { first_changed = 0; last_changed = ROWS*COLS; } }
-#define REGION_CHANGED(f, l)	{ \
+#define CHANGED(f, l, spill)	{ \
 	screen_changed = true; \
+	mark_rows(f, l, spill); \
 	if (IN_NVT) { \
 	    if (first_changed == -1 || f < first_changed) first_changed = f; \
 	    if (last_changed == -1 || l > last_changed) last_changed = l; } }
-#define ONE_CHANGED(n)	REGION_CHANGED(n, n+1)
+#define REGION_CHANGED(f, l)	CHANGED(f, l, formatted || dbcs)
+#define ONE_CHANGED(n)	CHANGED(n, n+1, dbcs || ea_buf[n].fa)
+#define FA_CHANGED(n)	CHANGED(n, n+1, true)
 
 #define DECODE_BADDR(c1, c2) \
 	((((c1) & 0xC0) == 0x00) ? \
@@ -165,6 +211,7 @@ ctlr_register(void)
     register_schange(ST_NEGOTIATING, ctlr_negotiating);
     register_schange(ST_CONNECT, ctlr_connect);
     register_schange(ST_3270_MODE, ctlr_connect);
+    register_schange(ST_CODEPAGE, ctlr_codepage_changed);
 }
 
 /*
@@ -206,6 +253,19 @@ ctlr_reinit(unsigned cmask)
 
 	ea_buf[-1].fa  = FA_PRINTABLE | FA_MODIFY;
 	aea_buf[-1].fa = FA_PRINTABLE | FA_MODIFY;
+
+	Replace(fa_index, (int *)Malloc(maxROWS * maxCOLS * sizeof(int)));
+	fa_valid = false;
+
+	Replace(rows_changed, (unsigned char *)Malloc(maxROWS));
+	memset(rows_changed, ROW_CHANGED, maxROWS);
+	rows_first = 0;
+	rows_last = maxROWS - 1;
+	Replace(rows_serial,
+		(unsigned long *)Calloc(maxROWS, sizeof(unsigned long)));
+	Replace(rows_hash, (uint64_t *)Calloc(maxROWS, sizeof(uint64_t)));
+	hash_rows = 0;
+	all_serial = ++change_serial;
     }
 }
 
@@ -310,17 +370,8 @@ ctlr_reset(void)
 static void
 set_formatted(void)
 {
-    int baddr;
-
-    formatted = false;
-    baddr = 0;
-    do {
-	if (ea_buf[baddr].fa) {
-	    formatted = true;
-	    break;
-	}
-	INC_BA(baddr);
-    } while (baddr != 0);
+    fa_index_sync();
+    formatted = fa_count > 0;
 }
 
 /*
@@ -368,11 +419,22 @@ ctlr_connect(bool ignored _is_unused)
 }
 
 /*
- * Find the buffer address of the field attribute for a given buffer address.
+ * Called when the host code page changes.
+ * Everything on the screen may now be displayed differently.
+ */
+static void
+ctlr_codepage_changed(bool ignored _is_unused)
+{
+    ALL_CHANGED;
+}
+
+/*
+ * Find the buffer address of the field attribute for a given buffer address,
+ * by scanning backwards.
  * Returns -1 if the screen isn't formatted.
  */
-int
-find_field_attribute_ea(int baddr, struct ea *ea)
+static int
+scan_field_attribute(int baddr, struct ea *ea)
 {
     int sbaddr;
 
@@ -386,6 +448,156 @@ find_field_attribute_ea(int baddr, struct ea *ea)
     return -1;
 }
 
+/*
+ * Test the field attribute index for validity.
+ */
+static bool
+fa_index_current(void)
+{
+    return fa_valid && fa_rows == ROWS && fa_cols == COLS;
+}
+
+/*
+ * Rebuild the field attribute index, if needed.
+ */
+static void
+fa_index_sync(void)
+{
+    int baddr;
+
+    if (fa_index_current()) {
+	return;
+    }
+    fa_count = 0;
+    for (baddr = 0; baddr < ROWS * COLS; baddr++) {
+	if (ea_buf[baddr].fa) {
+	    fa_index[fa_count++] = baddr;
+	}
+    }
+    fa_rows = ROWS;
+    fa_cols = COLS;
+    fa_valid = true;
+}
+
+/*
+ * Search the field attribute index.
+ * Returns the number of field attributes at addresses less than or equal to
+ * baddr.
+ */
+static int
+fa_index_search(int baddr)
+{
+    int lo = 0, hi = fa_count;
+
+    while (lo < hi) {
+	int mid = (lo + hi) / 2;
+
+	if (fa_index[mid] <= baddr) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid;
+	}
+    }
+    return lo;
+}
+
+/*
+ * Note that a field attribute has been added to ea_buf.
+ */
+static void
+fa_index_insert(int baddr)
+{
+    int ix;
+
+    if (!fa_index_current()) {
+	return;
+    }
+    ix = fa_index_search(baddr);
+    if (ix > 0 && fa_index[ix - 1] == baddr) {
+	return;
+    }
+    memmove(&fa_index[ix + 1], &fa_index[ix], (fa_count - ix) * sizeof(int));
+    fa_index[ix] = baddr;
+    fa_count++;
+}
+
+/*
+ * Note that a field attribute has been removed from ea_buf.
+ */
+static void
+fa_index_delete(int baddr)
+{
+    int ix;
+
+    if (!fa_index_current()) {
+	return;
+    }
+    ix = fa_index_search(baddr);
+    if (ix == 0 || fa_index[ix - 1] != baddr) {
+	return;
+    }
+    memmove(&fa_index[ix - 1], &fa_index[ix], (fa_count - ix) * sizeof(int));
+    fa_count--;
+}
+
+/*
+ * Test a region of ea_buf (which does not wrap) for field attributes.
+ * Returns true if there might be any.
+ */
+static bool
+fa_index_any(int baddr, int count)
+{
+    int ix;
+
+    if (!fa_index_current()) {
+	return true;
+    }
+    ix = fa_index_search(baddr - 1);
+    return ix < fa_count && fa_index[ix] < baddr + count;
+}
+
+/*
+ * Find the buffer address of the field attribute for a given buffer address,
+ * using the field attribute index.
+ * Returns -1 if the screen isn't formatted.
+ */
+static int
+fa_index_lookup(int baddr)
+{
+    int ix;
+    int faddr;
+
+    fa_index_sync();
+    if (fa_count == 0) {
+	faddr = -1;
+    } else {
+	/* If there is no attribute at or before baddr, the last one wraps. */
+	ix = fa_index_search(baddr);
+	faddr = fa_index[(ix > 0)? ix - 1: fa_count - 1];
+    }
+#if defined(FA_INDEX_DEBUG) /*[*/
+    if (faddr != scan_field_attribute(baddr, ea_buf)) {
+	fprintf(stderr, "fa_index_lookup(%d): index says %d, scan says %d\n",
+		baddr, faddr, scan_field_attribute(baddr, ea_buf));
+	abort();
+    }
+#endif /*]*/
+    return faddr;
+}
+
+/*
+ * Find the buffer address of the field attribute for a given buffer address.
+ * Returns -1 if the screen isn't formatted.
+ */
+int
+find_field_attribute_ea(int baddr, struct ea *ea)
+{
+    if (ea == ea_buf) {
+	return fa_index_lookup(baddr);
+    }
+    return scan_field_attribute(baddr, ea);
+}
+
 /*
  * Find the buffer address of the field attribute for a given buffer address.
  * Returns -1 if the screen isn't formatted.
@@ -396,7 +608,7 @@ find_field_attribute(int baddr)
     if (!formatted) {
 	return -1;
     }
-    return find_field_attribute_ea(baddr, ea_buf);
+    return fa_index_lookup(baddr);
 }
 
 /*
@@ -419,25 +631,30 @@ bool
 get_bounded_field_attribute(register int baddr, register int bound,
 	unsigned char *fa_out)
 {
-    int sbaddr;
+    int faddr;
 
     if (!formatted) {
 	*fa_out = ea_buf[-1].fa;
 	return true;
     }
 
-    sbaddr = baddr;
-    do {
-	if (ea_buf[baddr].fa) {
-	    *fa_out = ea_buf[baddr].fa;
-	    return true;
-	}
-	DEC_BA(baddr);
-    } while (baddr != sbaddr && baddr != bound);
-
-    /* Screen is unformatted (and 'formatted' is inaccurate). */
-    if (baddr == sbaddr) {
-	*fa_out = ea_buf[-1].fa;
+    /*
+     * Positions from baddr back to (but not including) bound are searched.
+     * If bound is baddr, the whole screen is searched.
+     */
+    faddr = fa_index_lookup(baddr);
+    if (bound == baddr) {
+	/*
+	 * If faddr is -1, the screen is unformatted (and 'formatted' is
+	 * inaccurate).
+	 */
+	*fa_out = ea_buf[faddr].fa;
+	return true;
+    }
+    if (faddr >= 0 &&
+	    (baddr - faddr + ROWS*COLS) % (ROWS*COLS) <
+	    (baddr - bound + ROWS*COLS) % (ROWS*COLS)) {
+	*fa_out = ea_buf[faddr].fa;
 	return true;
     }
 
@@ -463,18 +680,24 @@ fa2ea(int baddr)
 int
 next_unprotected(int baddr0)
 {
-    register int baddr, nbaddr;
+    int ix, n;
 
-    nbaddr = baddr0;
-    do {
-	baddr = nbaddr;
+    /* Walk the field attributes, starting with the one at or after baddr0. */
+    fa_index_sync();
+    ix = fa_index_search(baddr0 - 1);
+    for (n = 0; n < fa_count; n++, ix++) {
+	int baddr, nbaddr;
+
+	if (ix >= fa_count) {
+	    ix = 0;
+	}
+	baddr = fa_index[ix];
+	nbaddr = baddr;
 	INC_BA(nbaddr);
-	if (ea_buf[baddr].fa &&
-		!FA_IS_PROTECTED(ea_buf[baddr].fa) &&
-		!ea_buf[nbaddr].fa) {
+	if (!FA_IS_PROTECTED(ea_buf[baddr].fa) && !ea_buf[nbaddr].fa) {
 	    return nbaddr;
 	}
-    } while (nbaddr != baddr0);
+    }
     return 0;
 }
 
@@ -2493,6 +2716,10 @@ ctlr_clear(bool can_snap)
 
     /* Clear the screen. */
     memset((char *)ea_buf, 0, ROWS*COLS*sizeof(struct ea));
+    fa_count = 0;
+    fa_rows = ROWS;
+    fa_cols = COLS;
+    fa_valid = true;
     ALL_CHANGED;
     cursor_move(0);
     buffer_addr = 0;
@@ -2546,6 +2773,9 @@ ctlr_add(int baddr, unsigned char c, unsigned char cs)
 	    unselect(baddr, 1);
 	}
 	ONE_CHANGED(baddr);
+	if (ea_buf[baddr].fa) {
+	    fa_index_delete(baddr);
+	}
 	ea_buf[baddr].ec = c;
 	ea_buf[baddr].cs = cs;
 	ea_buf[baddr].fa = 0;
@@ -2553,6 +2783,55 @@ ctlr_add(int baddr, unsigned char c, unsigned char cs)
     }
 }
 
+/*
+ * Change a run of characters in the 3270 buffer, with the same effect as
+ * calling ctlr_add(), then ctlr_add_fg() and ctlr_add_gr() with zero, for
+ * each one. The run must not include any field attributes or wrap past the
+ * end of the buffer.
+ */
+void
+ctlr_add_run(int baddr, const unsigned char *c, const unsigned char *cs,
+	int count)
+{
+    int i;
+    int first = -1, last = -1;
+
+    for (i = 0; i < count; i++) {
+	struct ea *ea = &ea_buf[baddr + i];
+	unsigned char oc = ea->ucs4? 0: ea->ec;
+
+	if (!ea->ucs4 && ea->ec == c[i] && ea->cs == cs[i] &&
+		(!mode.m3279 || !ea->fg) && !ea->gr) {
+	    continue;
+	}
+	if ((ea->ucs4 || oc != c[i] || ea->cs != cs[i]) &&
+		trace_primed && !IsBlank(oc)) {
+	    if (toggled(SCREEN_TRACE)) {
+		trace_screen(false);
+	    }
+	    scroll_save(maxROWS);
+	    trace_primed = false;
+	}
+	if (screen_selected(baddr + i)) {
+	    unselect(baddr + i, 1);
+	}
+	ea->ec = c[i];
+	ea->cs = cs[i];
+	ea->ucs4 = 0;
+	if (mode.m3279) {
+	    ea->fg = 0;
+	}
+	ea->gr = 0;
+	if (first < 0) {
+	    first = i;
+	}
+	last = i;
+    }
+    if (first >= 0) {
+	CHANGED(baddr + first, baddr + last + 1, dbcs);
+    }
+}
+
 /*
  * Change a character in the 3270 buffer, NVT mode.
  * Removes any field attribute defined at that location.
@@ -2575,6 +2854,9 @@ ctlr_add_nvt(int baddr, ucs4_t ucs4, unsigned char cs)
 	    unselect(baddr, 1);
 	}
 	ONE_CHANGED(baddr);
+	if (ea_buf[baddr].fa) {
+	    fa_index_delete(baddr);
+	}
 	ea_buf[baddr].ucs4 = ucs4;
 	ea_buf[baddr].ec = 0;
 	ea_buf[baddr].cs = cs;
@@ -2592,14 +2874,21 @@ ctlr_add_nvt(int baddr, ucs4_t ucs4, unsigned char cs)
 void
 ctlr_add_fa(int baddr, unsigned char fa, unsigned char cs)
 {
-    /* Put a null in the display buffer. */
-    ctlr_add(baddr, EBC_null, cs);
-
     /*
-     * Store the new attribute, setting the 'printable' bits so that the
+     * Compute the new attribute, setting the 'printable' bits so that the
      * value will be non-zero.
      */
-    ea_buf[baddr].fa = FA_PRINTABLE | (fa & FA_MASK);
+    fa = FA_PRINTABLE | (fa & FA_MASK);
+    if (ea_buf[baddr].fa != fa) {
+	FA_CHANGED(baddr);
+    }
+
+    /* Put a null in the display buffer. */
+    ctlr_add(baddr, EBC_null, cs);
+
+    /* Store the new attribute. */
+    ea_buf[baddr].fa = fa;
+    fa_index_insert(baddr);
 }
 
 /* 
@@ -2731,6 +3020,9 @@ ctlr_bcopy(int baddr_from, int baddr_to, int count, int move_ea)
     /* Move the characters. */
     if (memcmp((char *) &ea_buf[baddr_from], (char *) &ea_buf[baddr_to],
 		count * sizeof(struct ea))) {
+	if (fa_index_any(baddr_from, count) || fa_index_any(baddr_to, count)) {
+	    fa_valid = false;
+	}
 	memmove(&ea_buf[baddr_to], &ea_buf[baddr_from],
 		count * sizeof(struct ea));
 	REGION_CHANGED(baddr_to, baddr_to + count);
@@ -2756,6 +3048,9 @@ ctlr_aclear(int baddr, int count, int clear_ea)
 {
     if (memcmp((char *)&ea_buf[baddr], (char *)zero_buf,
 		count * sizeof(struct ea))) {
+	if (fa_index_any(baddr, count)) {
+	    fa_valid = false;
+	}
 	memset((char *) &ea_buf[baddr], 0, count * sizeof(struct ea));
 	REGION_CHANGED(baddr, baddr + count);
 	if (area_is_selected(baddr, count)) {
@@ -2776,18 +3071,30 @@ ctlr_scroll(unsigned char fg, unsigned char bg)
 {
     int qty = (ROWS - 1) * COLS;
     bool obscured;
+    int first_row, last_row;
     int i;
 
     /* Make sure nothing is selected. (later this can be fixed) */
     unselect(0, ROWS*COLS);
 
-    /* Synchronize pending changes prior to this. */
+    /*
+     * Synchronize pending changes prior to this, if the screen needs it, or
+     * if the top row has changes that would otherwise never be displayed.
+     * Otherwise, when the host sends many lines at once, they are displayed
+     * once rather than once per line.
+     */
     obscured = screen_obscured();
-    if (!obscured && screen_changed) {
+    if (!obscured && screen_changed &&
+	    (screen_scroll_needs_sync() ||
+	     (ctlr_changed_rows(&first_row, &last_row) &&
+	      (rows_changed[0] & ROW_CHANGED)))) {
 	screen_disp(false);
     }
 
     /* Move ea_buf. */
+    if (fa_index_any(0, ROWS * COLS)) {
+	fa_valid = false;
+    }
     memmove(&ea_buf[0], &ea_buf[COLS], qty * sizeof(struct ea));
 
     /* Clear the last line. */
@@ -2803,6 +3110,27 @@ ctlr_scroll(unsigned char fg, unsigned char bg)
 	ea_buf[qty + i].bg = bg;
     }
 
+    /* Move the row change flags along with the rows. */
+    memmove(rows_changed, rows_changed + 1, ROWS - 1);
+    rows_changed[ROWS - 1] = 0;
+    if (rows_first > 0) {
+	rows_first--;
+	rows_last--;
+    } else if (rows_first == 0) {
+	rows_first = -1;
+	rows_last = -1;
+	for (i = 0; i < ROWS - 1; i++) {
+	    if (rows_changed[i]) {
+		if (rows_first < 0) {
+		    rows_first = i;
+		}
+		rows_last = i;
+	    }
+	}
+    }
+    mark_rows(qty, ROWS * COLS, false);
+    all_serial = ++change_serial;
+
     /* Update the screen. */
     if (obscured) {
 	ALL_CHANGED;
@@ -2818,6 +3146,250 @@ void
 ctlr_changed(int bstart, int bend)
 {
     REGION_CHANGED(bstart, bend);
+
+    /* The caller may have moved field attributes around, too. */
+    fa_valid = false;
+}
+
+/*
+ * Note that every row needs to be redrawn, because the screen module's image
+ * of it has moved, not because its contents have changed. Unlike
+ * ctlr_changed(), this does not mark the rows in rows_changed, so
+ * ctlr_scroll() can still tell whether the top row has undisplayed changes.
+ */
+void
+ctlr_rows_moved(void)
+{
+    screen_changed = true;
+    rows_moved = true;
+}
+
+/*
+ * Note that the rows from 'first' up to (but not including) 'last' have
+ * changed.  If 'spill' is set, the change may also affect the rest of the
+ * field (a field attribute or a DBCS subfield changed), which is resolved
+ * later by ctlr_changed_rows().
+ */
+static void
+mark_rows(int first, int last, bool spill)
+{
+    int first_row, last_row;
+    int row;
+
+    if (rows_changed == NULL || last <= first || COLS == 0) {
+	return;
+    }
+    if (last > ROWS * COLS) {
+	last = ROWS * COLS;
+    }
+    first_row = first / COLS;
+    last_row = (last - 1) / COLS;
+    change_serial++;
+    for (row = first_row; row <= last_row; row++) {
+	rows_changed[row] |= ROW_CHANGED;
+	rows_serial[row] = change_serial;
+    }
+    if (spill) {
+	rows_changed[last_row] |= ROW_SPILL;
+	all_serial = change_serial;
+    }
+    if (rows_first < 0 || first_row < rows_first) {
+	rows_first = first_row;
+    }
+    if (rows_last < 0 || last_row > rows_last) {
+	rows_last = last_row;
+    }
+}
+
+/*
+ * Return the range of rows that have changed since the last call to
+ * ctlr_changed_rows_reset().  Returns false if nothing has changed.
+ *
+ * Changes to field attributes (and in DBCS mode, to any character) can
+ * alter the way the rest of the field is displayed, so before reporting,
+ * the rows following such a change are marked, up to and including the row
+ * holding the next field attribute.
+ */
+bool
+ctlr_changed_rows(int *first_row, int *last_row)
+{
+    int row;
+
+    if (rows_first < 0) {
+	if (!rows_moved) {
+	    return false;
+	}
+	*first_row = 0;
+	*last_row = ROWS - 1;
+	return true;
+    }
+
+    for (row = rows_first; row <= rows_last; row++) {
+	int r, n;
+
+	if (!(rows_changed[row] & ROW_SPILL)) {
+	    continue;
+	}
+	rows_changed[row] &= ~ROW_SPILL;
+	for (r = (row + 1) % ROWS, n = 1; n < ROWS; r = (r + 1) % ROWS, n++) {
+	    struct ea *ea = &ea_buf[r * COLS];
+	    int col;
+
+	    rows_changed[r] |= ROW_CHANGED;
+	    if (r < rows_first) {
+		rows_first = r;
+	    }
+	    if (r > rows_last) {
+		rows_last = r;
+	    }
+	    for (col = 0; col < COLS; col++) {
+		if (ea[col].fa) {
+		    break;
+		}
+	    }
+	    if (col < COLS) {
+		break;
+	    }
+	}
+    }
+
+    *first_row = rows_moved? 0: rows_first;
+    *last_row = rows_moved? ROWS - 1: rows_last;
+    return true;
+}
+
+/*
+ * Test a row for changes.  Only valid after ctlr_changed_rows() returns
+ * true.
+ */
+bool
+ctlr_row_changed(int row)
+{
+    return row >= 0 && row < ROWS &&
+	(rows_moved || (rows_changed[row] & ROW_CHANGED));
+}
+
+/*
+ * Return the current change serial number.
+ */
+unsigned long
+ctlr_change_serial(void)
+{
+    return change_serial;
+}
+
+/*
+ * Test whether anything in rows 'first_row' through 'last_row' may have
+ * changed since ctlr_change_serial() returned 'serial'.
+ */
+bool
+ctlr_rows_changed_since(int first_row, int last_row, unsigned long serial)
+{
+    int row;
+
+    if (rows_serial == NULL || all_serial > serial) {
+	return true;
+    }
+    if (first_row < 0) {
+	first_row = 0;
+    }
+    if (last_row >= ROWS) {
+	last_row = ROWS - 1;
+    }
+    for (row = first_row; row <= last_row; row++) {
+	if (rows_serial[row] > serial) {
+	    return true;
+	}
+    }
+    return false;
+}
+
+/*
+ * Forget about changed rows, once a screen module has displayed them.
+ */
+void
+ctlr_changed_rows_reset(void)
+{
+    rows_moved = false;
+    if (rows_first >= 0) {
+	memset(rows_changed + rows_first, 0, rows_last - rows_first + 1);
+	rows_first = -1;
+	rows_last = -1;
+    }
+}
+
+/*
+ * Screen generation and content hash, for clients that only want to know
+ * whether the screen has changed since they last looked. The generation
+ * moves on, at most once per look, when anything has been marked changed.
+ * The hash covers the contents of the buffer. It is kept per row, and only
+ * the rows whose serial numbers have moved on are hashed again.
+ */
+#define FNV_OFFSET	0xcbf29ce484222325ULL
+#define FNV_PRIME	0x100000001b3ULL
+
+/*
+ * Return the screen generation number.
+ */
+unsigned long
+ctlr_screen_generation(void)
+{
+    if (change_serial != gen_serial) {
+	screen_gen++;
+	gen_serial = change_serial;
+    }
+    return screen_gen;
+}
+
+/*
+ * Return the hash of the screen contents.
+ */
+uint64_t
+ctlr_screen_hash(void)
+{
+    bool all;
+    int row;
+    uint64_t h;
+
+    if (rows_hash == NULL) {
+	return 0;
+    }
+    all = ROWS != hash_rows || COLS != hash_cols || all_serial > hash_serial;
+    if (!all && change_serial == hash_serial) {
+	return screen_hash;
+    }
+
+    h = FNV_OFFSET;
+    for (row = 0; row < ROWS; row++) {
+	if (all || rows_serial[row] > hash_serial) {
+	    const unsigned char *p = (const unsigned char *)&ea_buf[row * COLS];
+	    const unsigned char *end = p + COLS * sizeof(struct ea);
+	    uint64_t rh = FNV_OFFSET;
+
+	    while (p < end) {
+		rh = (rh ^ *p++) * FNV_PRIME;
+	    }
+	    rows_hash[row] = rh;
+	}
+	h = (h ^ rows_hash[row]) * FNV_PRIME;
+    }
+    h = (h ^ (uint64_t)(ROWS * 1000 + COLS)) * FNV_PRIME;
+
+    screen_hash = h;
+    hash_serial = change_serial;
+    hash_rows = ROWS;
+    hash_cols = COLS;
+    return screen_hash;
+}
+
+/*
+ * Report the screen generation number and content hash.
+ */
+const char *
+ctlr_query_screen_generation(void)
+{
+    return lazyaf("%lu %016llx", ctlr_screen_generation(),
+	    (unsigned long long)ctlr_screen_hash());
 }
 
 /*
@@ -2833,6 +3405,7 @@ ctlr_altbuffer(bool alt)
 	etmp = ea_buf;
 	ea_buf = aea_buf;
 	aea_buf = etmp;
+	fa_valid = false;
 
 	is_altbuffer = alt;
 	ALL_CHANGED;
@@ -2859,6 +3432,8 @@ mdt_set(int baddr)
 	ea_buf[faddr].fa |= FA_MODIFY;
 	if (appres.modified_sel) {
 	    ALL_CHANGED;
+	} else {
+	    mark_rows(faddr, faddr + 1, false);
 	}
     }
 }
@@ -2873,6 +3448,8 @@ mdt_clear(int baddr)
 	ea_buf[faddr].fa &= ~FA_MODIFY;
 	if (appres.modified_sel) {
 	    ALL_CHANGED;
+	} else {
+	    mark_rows(faddr, faddr + 1, false);
 	}
     }
 }
@@ -2931,6 +3508,8 @@ static bool mticking = false;
 static bool ticking_anyway = false;
 static ioid_t tick_id;
 static struct timeval t_want;
+static unsigned long txn_count = 0;	/* host operations completed */
+static unsigned long txn_usec = 0;	/* time the last one took */
 
 /* Return the difference in milliseconds between two timevals. */
 static long
@@ -2976,6 +3555,7 @@ ticking_stop(struct timeval *tp)
 {
     struct timeval t1;
     unsigned long cs;
+    bool unlocked = (tp != NULL);
 
     if (tp == NULL) {
 	gettimeofday(&t1, NULL);
@@ -3003,6 +3583,12 @@ ticking_stop(struct timeval *tp)
 	    ticking_anyway? "negotiation step": "operation",
 	    cs / 1000000L,
 	    cs % 1000000L);
+
+    /* Remember host operations that ended with the host unlocking. */
+    if (unlocked && !ticking_anyway) {
+	txn_count++;
+	txn_usec = cs;
+    }
     ticking_anyway = false;
 }
 
@@ -3040,6 +3626,17 @@ ctlr_query_formatted(void)
     return formatted? "formatted": "unformatted";
 }
 
+/*
+ * Report the number of host operations completed (AID to keyboard unlock)
+ * and how long the last one took, in seconds.
+ */
+const char *
+ctlr_query_response_time(void)
+{
+    return txn_count? lazyaf("%lu %lu.%06lu", txn_count,
+	    txn_usec / 1000000L, txn_usec % 1000000L): NULL;
+}
+
 const char *
 ctlr_query_max_size(void)
 {
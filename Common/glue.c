@@ -568,6 +568,8 @@ static opt_t base_opts[] = {
     "<name>", "Send <name> as TELNET terminal name" },
 { OptTrace,    OPT_BOOLEAN, true,  ResTrace,     toggle_aoffset(TRACING),
     NULL, "Enable tracing" },
+{ OptTraceBinary,OPT_BOOLEAN,true, ResTraceBinary,aoffset(trace_binary),
+    NULL, "Write traces in binary format" },
 { OptTraceFile,OPT_STRING,  false, ResTraceFile, aoffset(trace_file),
     "<file>", "Write traces to <file>" },
 { OptTraceFileSize,OPT_STRING,false,ResTraceFileSize,aoffset(trace_file_size),
@@ -1108,12 +1110,14 @@ static res_t base_resources[] = {
     { ResScriptPortOnce,aoffset(script_port_once),	XRM_BOOLEAN },
     { ResSuppressActions,aoffset(suppress_actions),XRM_STRING },
     { ResTermName,	aoffset(termname),	XRM_STRING },
+    { ResTraceBinary,aoffset(trace_binary),	XRM_BOOLEAN },
     { ResTraceDir,	aoffset(trace_dir),	XRM_STRING },
     { ResTraceFile,	aoffset(trace_file),	XRM_STRING },
     { ResTraceFileSize,aoffset(trace_file_size),	XRM_STRING },
     { ResTraceMonitor,aoffset(trace_monitor),	XRM_BOOLEAN },
     { ResUnlockDelay,aoffset(unlock_delay),	XRM_BOOLEAN },
     { ResUnlockDelayMs,aoffset(unlock_delay_ms),	XRM_INT },
+    { ResUseSelect,	aoffset(use_select),	XRM_BOOLEAN },
     { ResWerase,	aoffset(linemode.werase),XRM_STRING }
 };
 
@@ -95,6 +95,7 @@ typedef struct {
     field_t *fields;	/* field values */
     char *location;	/* real location for 301 errors */
     struct _httpd_reg *async_node; /* asynchronous event node */
+    httpd_etag_t *etag;	/* entity tag function */
     size_t it_offset;	/* input trace offset */
     size_t ot_offset;	/* output trace offset */
 } request_t;
@@ -160,6 +161,8 @@ status_text(int status_code)
 	return "OK";
     case 301:
 	return "Moved Permanently";
+    case 304:
+	return "Not Modified";
     case 400:
 	return "Bad Request";
     case 404:
@@ -419,6 +422,7 @@ httpd_reinit_request(request_t *r)
     free_fields(&r->queries);
     vb_reset(&r->print_buf);
     r->verb = VERB_OTHER;
+    r->etag = NULL;
     r->it_offset = 0;
     r->ot_offset = 0;
 }
@@ -2046,7 +2050,12 @@ httpd_dyn_complete(void *dhandle, const char *format, ...)
 
     /* Generate the output. */
     httpd_http_header(h, 200, !r->persistent, reg->content_str);
-    httpd_print(h, HP_SEND, "Cache-Control: no-store\n");
+    if (r->etag != NULL) {
+	httpd_print(h, HP_SEND, "Cache-Control: no-cache\n");
+	httpd_print(h, HP_SEND, "ETag: \"%s\"\n", (*r->etag)());
+    } else {
+	httpd_print(h, HP_SEND, "Cache-Control: no-store\n");
+    }
 
     switch (r->verb) {
     case VERB_GET:
@@ -2084,6 +2093,112 @@ httpd_dyn_complete(void *dhandle, const char *format, ...)
     }
 }
 
+/**
+ * Set the entity tag function for a dynamic HTTP request.
+ *
+ * The function is called when the response is generated, and its result is
+ * sent as an ETag header. The response can then be revalidated with
+ * If-None-Match instead of being fetched again.
+ *
+ * @param[in] dhandle	Connection handle
+ * @param[in] etag	Entity tag function
+ */
+void
+httpd_set_etag(void *dhandle, httpd_etag_t *etag)
+{
+    httpd_t *h = (httpd_t *)dhandle;
+
+    h->request.etag = etag;
+}
+
+/**
+ * Check a dynamic HTTP request's If-None-Match field against its entity tag.
+ *
+ * @param[in] dhandle	Connection handle
+ *
+ * @return true if the client's copy is current
+ */
+bool
+httpd_etag_matches(void *dhandle)
+{
+    httpd_t *h = (httpd_t *)dhandle;
+    request_t *r = &h->request;
+    const char *inm;
+    const char *etag;
+    size_t etag_len;
+
+    if (r->etag == NULL ||
+	    (inm = lookup_field("If-None-Match", r->fields)) == NULL) {
+	return false;
+    }
+
+    etag = (*r->etag)();
+    etag_len = strlen(etag);
+    while (*inm) {
+	const char *start;
+
+	while (*inm == ' ' || *inm == '\t' || *inm == ',') {
+	    inm++;
+	}
+	if (*inm == '*') {
+	    return true;
+	}
+	if (!strncmp(inm, "W/", 2)) {
+	    inm += 2;
+	}
+	if (*inm != '"') {
+	    return false;
+	}
+	start = ++inm;
+	while (*inm && *inm != '"') {
+	    inm++;
+	}
+	if (*inm != '"') {
+	    return false;
+	}
+	if ((size_t)(inm - start) == etag_len &&
+		!strncmp(start, etag, etag_len)) {
+	    return true;
+	}
+	inm++;
+    }
+    return false;
+}
+
+/**
+ * Complete a dynamic HTTP request whose entity has not changed.
+ *
+ * Called from a synchronous method, when httpd_etag_matches() succeeds.
+ *
+ * @param[in] dhandle	Connection handle
+ *
+ * @return httpd_status_t (HS_SUCCESS_OPEN or HS_SUCCESS_CLOSE).
+ */
+httpd_status_t
+httpd_dyn_not_modified(void *dhandle)
+{
+    httpd_t *h = (httpd_t *)dhandle;
+    request_t *r = &h->request;
+    httpd_reg_t *reg = r->async_node;
+
+    /* Un-mark the node. */
+    r->async_node = NULL;
+
+    /* Generate the output. There is no body. */
+    httpd_http_header(h, 304, !r->persistent, reg->content_str);
+    httpd_print(h, HP_SEND, "Cache-Control: no-cache\n");
+    httpd_print(h, HP_SEND, "ETag: \"%s\"\n", (*r->etag)());
+    httpd_print(h, HP_SEND, "\n");
+
+    /* Return status. */
+    if (!r->persistent) {
+	return HS_SUCCESS_CLOSE;
+    } else {
+	httpd_reinit_request(r);
+	return HS_SUCCESS_OPEN;
+    }
+}
+
 /**
  * Unsuccessfully complete a dynamic HTTP request.
  *
@@ -42,7 +42,13 @@
 #include <fcntl.h>
 #include <assert.h>
 
+#include "codepage.h"
+#include "ctlrc.h"
 #include "fprint_screen.h"
+#include "lazya.h"
+#include "names.h"
+#include "task.h"
+#include "utils.h"
 #include "varbuf.h"
 
 #include "httpd-core.h"
@@ -56,6 +62,115 @@
 extern unsigned char favicon[];
 extern unsigned favicon_size;
 
+/* Actions that only read the screen, and can be answered with 304. */
+static const char *read_only_actions[] = {
+    AnAscii, AnAscii1, AnAsciiField, AnEbcdic, AnEbcdic1, AnEbcdicField,
+    AnReadBuffer, NULL
+};
+
+/**
+ * Compute the entity tag for the screen.
+ *
+ * It covers the screen contents, the status line and the code page.
+ *
+ * @return Entity tag
+ */
+static const char *
+screen_etag(void)
+{
+    char *st = task_status_string();
+    const char *cp = get_codepage_name();
+    unsigned long h = 5381;
+    const char *s;
+
+    for (s = st; *s; s++) {
+	h = (h * 33) ^ (unsigned char)*s;
+    }
+    for (s = cp; *s; s++) {
+	h = (h * 33) ^ (unsigned char)*s;
+    }
+    Free(st);
+    return lazyaf("%016llx-%08lx", (unsigned long long)ctlr_screen_hash(),
+	    h & 0xffffffffUL);
+}
+
+/**
+ * Check a REST action string for actions that only read the screen.
+ *
+ * This is deliberately conservative: anything it does not understand,
+ * including quoted parameters, is treated as possibly changing state.
+ *
+ * @param[in] url	Action string
+ *
+ * @return true if every action is read-only
+ */
+static bool
+rest_read_only(const char *url)
+{
+    const char *s = url;
+
+    while (*s) {
+	const char *name;
+	size_t len;
+	int i;
+
+	while (*s == ' ') {
+	    s++;
+	}
+	if (!*s) {
+	    break;
+	}
+	name = s;
+	while (isalnum((unsigned char)*s)) {
+	    s++;
+	}
+	len = s - name;
+	for (i = 0; read_only_actions[i] != NULL; i++) {
+	    if (strlen(read_only_actions[i]) == len &&
+		    !strncasecmp(read_only_actions[i], name, len)) {
+		break;
+	    }
+	}
+	if (read_only_actions[i] == NULL) {
+	    return false;
+	}
+	if (*s == '(') {
+	    s++;
+	    while (*s && *s != ')') {
+		if (*s == '"' || *s == '(') {
+		    return false;
+		}
+		s++;
+	    }
+	    if (*s != ')') {
+		return false;
+	    }
+	    s++;
+	} else if (*s && *s != ' ') {
+	    return false;
+	}
+    }
+    return s != url;
+}
+
+/**
+ * Set up the entity tag for a REST request, and check it.
+ *
+ * @param[in] url	Action string
+ * @param[in] dhandle	Session handle
+ *
+ * @return true if the client's copy is current
+ */
+static bool
+rest_not_modified(const char *url, void *dhandle)
+{
+    if (!rest_read_only(url)) {
+	return false;
+    }
+    httpd_set_etag(dhandle, screen_etag);
+    return httpd_etag_matches(dhandle);
+}
+
 /**
  * Capture the screen image.
  *
@@ -149,6 +264,12 @@ hn_screen_image(const char *uri, void *dhandle)
     httpd_status_t rv;
     varbuf_t r;
 
+    /* Answer a revalidation without rendering, if nothing has changed. */
+    httpd_set_etag(dhandle, screen_etag);
+    if (httpd_etag_matches(dhandle)) {
+	return httpd_dyn_not_modified(dhandle);
+    }
+
     /* Get the image. */
     if (hn_image(dhandle, &r, &rv)) {
 	/* Success: Write the response. */
@@ -334,6 +455,9 @@ rest_text_dyn(const char *url, void *dhandle)
     if (!*url) {
 	return httpd_dyn_error(dhandle, CT_TEXT, 400, "Missing 3270 action.\n");
     }
+    if (rest_not_modified(url, dhandle)) {
+	return httpd_dyn_not_modified(dhandle);
+    }
 
     switch (hio_to3270(url, rest_dyn_text_complete, dhandle, CT_TEXT)) {
     case SENDTO_COMPLETE:
@@ -395,6 +519,9 @@ rest_status_text_dyn(const char *url, void *dhandle)
     if (!*url) {
 	return httpd_dyn_error(dhandle, CT_TEXT, 400, "Missing 3270 action.\n");
     }
+    if (rest_not_modified(url, dhandle)) {
+	return httpd_dyn_not_modified(dhandle);
+    }
 
     switch (hio_to3270(url, rest_dyn_status_text_complete, dhandle, CT_TEXT)) {
     case SENDTO_COMPLETE:
@@ -528,6 +655,9 @@ rest_html_dyn(const char *url, void *dhandle)
     if (!*url) {
 	return httpd_dyn_error(dhandle, CT_HTML, 400, "Missing 3270 action.\n");
     }
+    if (rest_not_modified(url, dhandle)) {
+	return httpd_dyn_not_modified(dhandle);
+    }
 
     switch (hio_to3270(url, rest_dyn_html_complete, dhandle, CT_HTML)) {
     case SENDTO_COMPLETE:
@@ -556,6 +686,9 @@ rest_json_dyn(const char *url, void *dhandle)
     if (!*url) {
 	return httpd_dyn_error(dhandle, CT_JSON, 400, "Missing 3270 action.\n");
     }
+    if (rest_not_modified(url, dhandle)) {
+	return httpd_dyn_not_modified(dhandle);
+    }
 
     switch (hio_to3270(url, rest_dyn_json_complete, dhandle, CT_JSON)) {
     case SENDTO_COMPLETE:
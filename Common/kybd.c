@@ -1074,6 +1074,47 @@ key_Character_wrapper(ia_t ia _is_unused, unsigned argc, const char **argv)
     return true;
 }
 
+/*
+ * Replace the nulls in a field that precede buffer address 'baddr' with
+ * blanks, back to the field attribute at 'faddr' or to a preceding line
+ * that is all nulls.
+ */
+static void
+blank_fill(int baddr, int faddr)
+{
+    register int baddr_fill = baddr;
+
+    DEC_BA(baddr_fill);
+    while (baddr_fill != faddr) {
+
+	/* Check for backward line wrap. */
+	if ((baddr_fill % COLS) == COLS - 1) {
+	    bool aborted = true;
+	    register int baddr_scan = baddr_fill;
+
+	    /* Check the field within the preceeding line for NULLs. */
+	    while (baddr_scan != faddr) {
+		if (ea_buf[baddr_scan].ec != EBC_null) {
+		    aborted = false;
+		    break;
+		}
+		if (!(baddr_scan % COLS)) {
+		    break;
+		}
+		DEC_BA(baddr_scan);
+	    }
+	    if (aborted) {
+		break;
+	    }
+	}
+
+	if (ea_buf[baddr_fill].ec == EBC_null) {
+	    ctlr_add(baddr_fill, EBC_space, 0);
+	}
+	DEC_BA(baddr_fill);
+    }
+}
+
 /*
  * Handle an ordinary displayable character key.  Lots of stuff to handle
  * insert-mode, protected fields and etc.
@@ -1283,37 +1324,7 @@ key_Character(unsigned ebc, bool with_ge, bool pasting, bool oerr_fail,
 
     /* Replace leading nulls with blanks, if desired. */
     if (formatted && toggled(BLANK_FILL)) {
-	register int baddr_fill = baddr;
-
-	DEC_BA(baddr_fill);
-	while (baddr_fill != faddr) {
-
-	    /* Check for backward line wrap. */
-	    if ((baddr_fill % COLS) == COLS - 1) {
-		bool aborted = true;
-		register int baddr_scan = baddr_fill;
-
-		/* Check the field within the preceeding line for NULLs. */
-		while (baddr_scan != faddr) {
-		    if (ea_buf[baddr_scan].ec != EBC_null) {
-			aborted = false;
-			break;
-		    }
-		    if (!(baddr_scan % COLS)) {
-			break;
-		    }
-		    DEC_BA(baddr_scan);
-		}
-		if (aborted) {
-		    break;
-		}
-	    }
-
-	    if (ea_buf[baddr_fill].ec == EBC_null) {
-		ctlr_add(baddr_fill, EBC_space, 0);
-	    }
-	    DEC_BA(baddr_fill);
-	}
+	blank_fill(baddr, faddr);
     }
 
     mdt_set(cursor_addr);
@@ -2911,10 +2922,11 @@ EraseEOF_action(ia_t ia, unsigned argc, const char **argv)
 	if (d == DBCS_RIGHT) {
 	    baddr = cursor_addr;
 	    DEC_BA(baddr);
-	    ea_buf[baddr].ec = EBC_si;
 	} else {
-	    ea_buf[cursor_addr].ec = EBC_si;
+	    baddr = cursor_addr;
 	}
+	ea_buf[baddr].ec = EBC_si;
+	ctlr_changed(baddr, baddr + 1);
     }
     ctlr_dbcs_postprocess();
     return true;
@@ -3608,6 +3620,120 @@ ns_action(action_t action, enum iaction cause, const char *param)
 
 }
 
+/*
+ * Fast path for a run of ordinary characters from String() or a paste.
+ *
+ * If the characters would go one at a time through key_UCharacter() and
+ * key_Character() into overlay positions of a single unprotected 3270
+ * field, they are stored together instead, with MDT, auto-skip and DBCS
+ * post-processing done once for the whole run. Anything that would take
+ * another branch of key_Character() -- insert mode, DBCS, SO/SI, numeric
+ * lock, control characters, the end of the field -- ends the run, and is
+ * left for the per-character path. A pasted run also stops at the end of
+ * the row, so the caller's margin and wrap checks still see each row.
+ *
+ * Returns the number of characters consumed, possibly 0. If it is not 0,
+ * *last_addrp is returned as the address of the last character stored.
+ */
+#define UCHAR_RUN_MAX	256
+static size_t
+key_UCharacter_run(const ucs4_t *ws, size_t xlen, bool pasting,
+	int *last_addrp)
+{
+    unsigned char ebcs[UCHAR_RUN_MAX];
+    unsigned char css[UCHAR_RUN_MAX];
+    int baddr, faddr;
+    unsigned char fa;
+    int size = ROWS * COLS;
+    int row_end;
+    int n;
+    bool auto_skip = !(pasting && toggled(OVERLAY_PASTE));
+
+    if (!IN_3270 || kybdlock || composing != NONE || dbcs ||
+	    toggled(INSERT_MODE) || toggled(REVERSE_INPUT)) {
+	return 0;
+    }
+    baddr = cursor_addr;
+    if (ea_buf[baddr].fa) {
+	return 0;
+    }
+    faddr = find_field_attribute(baddr);
+    fa = get_field_attribute(baddr);
+    if (FA_IS_PROTECTED(fa) || (faddr >= 0 && ea_buf[faddr].cs == CS_DBCS)) {
+	return 0;
+    }
+    row_end = pasting? (BA_TO_ROW(baddr) + 1) * COLS: size;
+
+    for (n = 0; n < (int)xlen && n < UCHAR_RUN_MAX; n++) {
+	int xaddr = baddr + n;
+	ucs4_t c = ws[n];
+	ebc_t ebc;
+	bool ge;
+
+	/* Stop at anything emulate_uinput() handles specially. */
+	if (c < 0x20 || (c == '\\' && !pasting) ||
+		(c >= UPRIV2 && c <= UPRIV_dup)) {
+	    break;
+	}
+
+	/* Stop at anything key_Character() handles specially. */
+	if (xaddr >= row_end ||
+		ea_buf[xaddr].fa ||
+		ea_buf[xaddr].ec == EBC_so ||
+		ea_buf[xaddr].ec == EBC_si) {
+	    break;
+	}
+	ebc = unicode_to_ebcdic_ge(c, &ge, toggled(APL_MODE));
+	if (ebc < 0x40 || (ebc & 0xff00)) {
+	    break;
+	}
+	if (FA_IS_NUMERIC(fa) && appres.numeric_lock &&
+		!((ebc >= EBC_0 && ebc <= EBC_9) ||
+		  ebc == EBC_minus ||
+		  ebc == EBC_period ||
+		  ebc == EBC_comma)) {
+	    break;
+	}
+	ebcs[n] = (unsigned char)ebc;
+	css[n] = ge? CS_GE: 0;
+    }
+    if (n == 0) {
+	return 0;
+    }
+
+    vtrace(" %s -> Key() x %d\n", ia_name[(int)(pasting? IA_PASTE: IA_STRING)],
+	    n);
+    ctlr_add_run(baddr, ebcs, css, n);
+    *last_addrp = baddr + n - 1;
+    baddr = (baddr + n) % size;
+
+    /*
+     * Replace leading nulls with blanks, if desired. The run itself has no
+     * nulls, so filling once from its end gives the same result as filling
+     * after each character.
+     */
+    if (formatted && toggled(BLANK_FILL)) {
+	blank_fill(baddr, faddr);
+    }
+
+    mdt_set(*last_addrp);
+
+    /* Implement auto-skip, and don't land on attribute bytes. */
+    if (auto_skip) {
+	while (ea_buf[baddr].fa) {
+	    if (FA_IS_SKIP(ea_buf[baddr].fa)) {
+		baddr = next_unprotected(baddr);
+	    } else {
+		INC_BA(baddr);
+	    }
+	}
+    }
+    cursor_move(baddr);
+
+    ctlr_dbcs_postprocess();
+    return n;
+}
+
 /*
  * Pretend that a sequence of keys was entered at the keyboard.
  *
@@ -3787,8 +3913,24 @@ emulate_uinput(const ucs4_t *ws, size_t xlen, bool pasting)
 		    /* Untranslatable CP 310 code point. */
 		    key_Character(c - UPRIV_GE_00, true, ia, true, NULL);
 		} else {
+		    size_t n;
+		    int run_addr;
+
 		    /* Ordinary text. */
-		    key_UCharacter(c, KT_STD, ia, true);
+		    n = key_UCharacter_run(ws, xlen, pasting, &run_addr);
+		    if (n > 0) {
+			/*
+			 * Consume all but the last character here, and
+			 * leave the cursor tracking as if the last one had
+			 * been entered on its own.
+			 */
+			ws += n - 1;
+			xlen -= n - 1;
+			last_addr = run_addr;
+			last_row = BA_TO_ROW(run_addr);
+		    } else {
+			key_UCharacter(c, KT_STD, ia, true);
+		    }
 		}
 		break;
 	    }
@@ -1,9 +1,10 @@
 # Object files for lib3270.
-LIB3270_OBJECTS = Malloc.o XtGlue.o actions.o b8.o bind-opt.o child.o \
-	childscript.o codepage.o ctlr.o event.o favicon.o fprint_screen.o \
-	ft.o ft_cut.o ft_dft.o glue.o host.o httpd-core.o httpd-io.o \
-	httpd-nodes.o icmd.o idle.o kybd.o linemode.o login_macro.o llist.o \
-	model.o nvt.o peerscript.o popups_glue.o print_screen.o query.o \
-	readres.o resources.o rpq.o run_action.o screentrace.o sf.o \
-	sio_glue.o source.o stdinscript.o stringscript.o task.o telnet.o \
-	telnet_new_environ.o telnet_sio.o toggles.o trace.o util.o xio.o
+LIB3270_OBJECTS = Malloc.o XtGlue.o actions.o b8.o bind-opt.o bintrace.o \
+	child.o childscript.o codepage.o ctlr.o event.o favicon.o \
+	fprint_screen.o ft.o ft_cut.o ft_dft.o glue.o host.o httpd-core.o \
+	httpd-io.o httpd-nodes.o icmd.o idle.o kybd.o linemode.o \
+	login_macro.o llist.o model.o nvt.o peerscript.o popups_glue.o \
+	print_screen.o query.o readres.o resources.o rpq.o run_action.o \
+	screentrace.o sf.o sio_glue.o source.o stdinscript.o stringscript.o \
+	task.o telnet.o telnet_new_environ.o telnet_sio.o toggles.o trace.o \
+	util.o xio.o
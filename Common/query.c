@@ -335,7 +335,9 @@ query_register(void)
 	{ KwModel, NULL, full_model_name, true, false },
 	{ KwPrefixes, host_prefixes, NULL, false, false },
 	{ KwProxy, get_proxy, NULL, false, false },
+	{ KwResponseTime, ctlr_query_response_time, NULL, false, false },
 	{ KwScreenCurSize, ctlr_query_cur_size_old, NULL, true, false },
+	{ KwScreenGeneration, ctlr_query_screen_generation, NULL, false, false },
 	{ KwScreenMaxSize, ctlr_query_max_size_old, NULL, true, false },
 	{ KwScreenSizeCurrent, ctlr_query_cur_size, NULL, false, false },
 	{ KwScreenSizeMax, ctlr_query_max_size, NULL, false, false },
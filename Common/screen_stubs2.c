@@ -33,6 +33,7 @@
 
 #include "globals.h"
 
+#include "ctlrc.h"
 #include "screen.h"
 
 static int cw = 7;
@@ -91,9 +92,23 @@ screen_obscured(void)
     return false;
 }
 
+/*
+ * There is no saved image to scroll, so every row must be redrawn.
+ */
 void
 screen_scroll(unsigned char fg, unsigned char bg)
 {
+    ctlr_rows_moved();
+}
+
+/*
+ * Since screen_scroll() has every row redrawn, pending changes do not need
+ * to be displayed before scrolling.
+ */
+bool
+screen_scroll_needs_sync(void)
+{
+    return false;
 }
 
 unsigned long
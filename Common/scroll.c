@@ -38,6 +38,7 @@
 
 #include "3270ds.h"
 #include "actions.h"
+#include "bintrace.h"
 #include "ctlrc.h"
 #include "kybd.h"
 #include "names.h"
@@ -57,8 +58,41 @@ bool	scroll_initted = false;
 
 /* Statics */
 
-/* Saved screens. */
-static struct ea **ea_save = (struct ea **) NULL;
+/*
+ * Saved lines, in a ring of scroll_max entries.
+ *
+ * To allow for long histories, each line is kept in a compact form, as a
+ * byte string:
+ *   varint: number of cells saved from the screen (the rest of the line, out
+ *           to maxCOLS, is taken from defaults_buf)
+ *   varint: number of those cells that precede any trailing all-zero cells
+ *   then runs of cells with identical attributes, covering the latter:
+ *     byte:   run type (RUN_EC, RUN_UCS4 or RUN_BOTH)
+ *     varint: cell count
+ *     bytes:  fa, fg, bg, gr, cs, ic, db
+ *     per cell: ec (RUN_EC, RUN_BOTH), then ucs4 as a varint (RUN_UCS4,
+ *               RUN_BOTH)
+ * A NULL entry is a line that was never saved, which is all zeroes.
+ */
+static unsigned char **line_save = NULL;
+#define RUN_EC		0	/* ec only, ucs4 is 0 */
+#define RUN_UCS4	1	/* ucs4 only, ec is 0 */
+#define RUN_BOTH	2	/* ec and ucs4 */
+#define RUN_TYPE(e)	((e)->ucs4? ((e)->ec? RUN_BOTH: RUN_UCS4): RUN_EC)
+#define SAME_ATTRS(e, f) \
+    ((e)->fa == (f)->fa && (e)->fg == (f)->fg && (e)->bg == (f)->bg && \
+     (e)->gr == (f)->gr && (e)->cs == (f)->cs && (e)->ic == (f)->ic && \
+     (e)->db == (f)->db)
+#define IS_ZERO_EA(e)	(!(e)->ec && !(e)->ucs4 && !(e)->fa && !(e)->fg && \
+			 !(e)->bg && !(e)->gr && !(e)->cs && !(e)->ic && \
+			 !(e)->db)
+
+/* Work areas for encoding and decoding lines. */
+static unsigned char *line_scratch = NULL;
+static struct ea *line_ea = NULL;
+
+/* The screen image, saved uncompressed when scrolling back starts. */
+static struct ea *image_save = NULL;
 
 /* Number of lines saved. */
 static int      n_saved = 0;
@@ -67,9 +101,6 @@ static int      scroll_next = 0;
 static int      scrolled_back = 0;
 static bool  need_saving = true;
 static bool  vscreen_swapped = false;
-static char    *sbuf = NULL;
-static int      sa_bufsize;
-static char    *zbuf = NULL;
 static struct ea *defaults_buf = NULL;
 
 /* Thumb state: */
@@ -97,8 +128,17 @@ void
 scroll_buf_init(void)
 {
     register int i;
-    int sa_size;
-    unsigned char *s;
+
+    if (line_save != NULL) {
+	for (i = 0; i < scroll_max; i++) {
+	    Free(line_save[i]);
+	}
+	Free(line_save);
+	Free(line_scratch);
+	Free(line_ea);
+	Free(image_save);
+	Free(defaults_buf);
+    }
 
     /* Set the number of rows to save, as a multiple of maxROWS. */
     scroll_max = appres.interactive.save_lines;
@@ -108,19 +148,13 @@ scroll_buf_init(void)
     if (scroll_max < maxROWS * 5) {
 	scroll_max = maxROWS * 5;
     }
-    if (sbuf != NULL) {
-	Free(sbuf);
-	Free(zbuf);
-	Free(defaults_buf);
-	Free(ea_save);
-    }
-    sa_size = scroll_max + maxROWS;
-    ea_save = (struct ea **)Calloc(sizeof(struct ea *), sa_size);
-    sa_bufsize = (sa_size *
-	    (sizeof(unsigned char) + sizeof(struct ea))) * maxCOLS;
-    sbuf = Malloc(sa_bufsize);
-    zbuf = Malloc(maxCOLS);
-    memset(zbuf, '\0', maxCOLS);
+    line_save = (unsigned char **)Calloc(scroll_max,
+	    sizeof(unsigned char *));
+
+    /* Worst case is a run per cell, with a 5-byte count and ucs4. */
+    line_scratch = (unsigned char *)Malloc(10 + (maxCOLS * 19));
+    line_ea = (struct ea *)Malloc(maxCOLS * sizeof(struct ea));
+    image_save = (struct ea *)Calloc(maxROWS * maxCOLS, sizeof(struct ea));
     defaults_buf = Calloc(maxCOLS, sizeof(struct ea));
     for (i = 0; i < maxCOLS; i++) {
 	/*
@@ -131,14 +165,132 @@ scroll_buf_init(void)
 	defaults_buf[i].bg = HOST_COLOR_BLACK;
 	defaults_buf[i].gr = XAH_INTENSIFY & 0x0f;
     }
-    s = (unsigned char *)sbuf;
-    for (i = 0; i < sa_size; s += (maxCOLS * sizeof(struct ea)), i++) {
-	ea_save[i] = (struct ea *)s;
-    }
     scroll_reset();
     scroll_initted = true;
 }
 
+/*
+ * Fetch a varint from a saved line. The lines are built by line_encode(), so
+ * the varint is known to be complete.
+ */
+static unsigned long
+get_varint(const unsigned char **pp)
+{
+    uint64_t v = 0;
+
+    varint_get(pp, *pp + VARINT_MAX, &v);
+    return (unsigned long)v;
+}
+
+/*
+ * Encode 'ncells' cells of a line for saving.
+ * Returns a Malloc'd copy.
+ */
+static unsigned char *
+line_encode(const struct ea *ea, int ncells)
+{
+    unsigned char *p = line_scratch;
+    unsigned char *ret;
+    int nbody = ncells;
+    int i, j, k;
+
+    while (nbody > 0 && IS_ZERO_EA(&ea[nbody - 1])) {
+	nbody--;
+    }
+    p = varint_put(p, ncells);
+    p = varint_put(p, nbody);
+
+    for (i = 0; i < nbody; i = j) {
+	int type = RUN_TYPE(&ea[i]);
+
+	for (j = i + 1;
+	     j < nbody && RUN_TYPE(&ea[j]) == type &&
+		SAME_ATTRS(&ea[i], &ea[j]);
+	     j++) {
+	}
+	*p++ = type;
+	p = varint_put(p, j - i);
+	*p++ = ea[i].fa;
+	*p++ = ea[i].fg;
+	*p++ = ea[i].bg;
+	*p++ = ea[i].gr;
+	*p++ = ea[i].cs;
+	*p++ = ea[i].ic;
+	*p++ = ea[i].db;
+	for (k = i; k < j; k++) {
+	    if (type != RUN_UCS4) {
+		*p++ = ea[k].ec;
+	    }
+	    if (type != RUN_EC) {
+		p = varint_put(p, ea[k].ucs4);
+	    }
+	}
+    }
+
+    ret = (unsigned char *)Malloc(p - line_scratch);
+    memcpy(ret, line_scratch, p - line_scratch);
+    return ret;
+}
+
+/*
+ * Decode a saved line into 'cols' cells.
+ */
+static void
+line_decode(const unsigned char *s, struct ea *ea, int cols)
+{
+    int ncells, nbody;
+    int i = 0;
+
+    if (s == NULL) {
+	memset(ea, 0, cols * sizeof(struct ea));
+	return;
+    }
+
+    ncells = (int)get_varint(&s);
+    nbody = (int)get_varint(&s);
+    memset(line_ea, 0, ncells * sizeof(struct ea));
+    memcpy(line_ea + ncells, defaults_buf + ncells,
+	    (maxCOLS - ncells) * sizeof(struct ea));
+
+    while (i < nbody) {
+	int type = *s++;
+	int count = (int)get_varint(&s);
+	struct ea attrs;
+
+	memset(&attrs, 0, sizeof(attrs));
+	attrs.fa = *s++;
+	attrs.fg = *s++;
+	attrs.bg = *s++;
+	attrs.gr = *s++;
+	attrs.cs = *s++;
+	attrs.ic = *s++;
+	attrs.db = *s++;
+	while (count--) {
+	    line_ea[i] = attrs; /* struct copy */
+	    if (type != RUN_UCS4) {
+		line_ea[i].ec = *s++;
+	    }
+	    if (type != RUN_EC) {
+		line_ea[i].ucs4 = (ucs4_t)get_varint(&s);
+	    }
+	    i++;
+	}
+    }
+
+    memcpy(ea, line_ea, cols * sizeof(struct ea));
+}
+
+/* Save one line in the next slot. */
+static void
+save_line(const struct ea *ea, int ncells)
+{
+    Replace(line_save[scroll_next], line_encode(ea, ncells));
+    scroll_next = (scroll_next + 1) % scroll_max;
+    if (n_saved < scroll_max) {
+	n_saved++;
+    }
+}
+
 static void
 screen_set_thumb_traced(float top, float shown, int saved, int screen,
 	int back)
@@ -160,7 +312,12 @@ screen_set_thumb_traced(float top, float shown, int saved, int screen,
 static void
 scroll_reset(void)
 {
-    memset(sbuf, 0, sa_bufsize);
+    int i;
+
+    for (i = 0; i < scroll_max; i++) {
+	Replace(line_save[i], NULL);
+    }
+    memset(image_save, 0, maxROWS * maxCOLS * sizeof(struct ea));
     scroll_next = 0;
     n_saved = 0;
     scrolled_back = 0;
@@ -193,31 +350,13 @@ scroll_save(int n)
     /* Save the screen contents. */
     for (row = 0; row < n; row++) {
 	if (row < ROWS) {
-	    memmove(ea_save[scroll_next],
-		    ea_buf + (row * COLS),
-		    COLS * sizeof(struct ea));
-	    if (COLS < maxCOLS) {
-		memcpy(ea_save[scroll_next] + COLS, defaults_buf,
-			(maxCOLS - COLS) * sizeof(struct ea));
-	    }
+	    save_line(ea_buf + (row * COLS), COLS);
 	} else {
-	    memcpy(ea_save[scroll_next], defaults_buf,
-		    maxCOLS * sizeof(struct ea));
-	}
-	scroll_next = (scroll_next + 1) % scroll_max;
-	if (n_saved < scroll_max) {
-	    n_saved++;
+	    save_line(NULL, 0);
 	}
     }
     if (n == ROWS && n < maxROWS) {
-	for (row = n; row < maxROWS; row++) {
-	    memcpy(ea_save[scroll_next], defaults_buf,
-		    maxCOLS * sizeof(struct ea));
-	}
-	scroll_next = (scroll_next + 1) % scroll_max;
-	if (n_saved < scroll_max) {
-	    n_saved++;
-	}
+	save_line(NULL, 0);
     }
 
     /*
@@ -229,12 +368,7 @@ scroll_save(int n)
 	int pad;
 
 	for (pad = maxROWS - (scroll_next % maxROWS); pad; pad--) {
-	    memcpy(ea_save[scroll_next], defaults_buf,
-		    maxCOLS * sizeof(struct ea));
-	    scroll_next = (scroll_next + 1) % scroll_max;
-	    if (n_saved < scroll_max) {
-		n_saved++;
-	    }
+	    save_line(NULL, 0);
 	}
 
     }
@@ -281,7 +415,7 @@ save_image(void)
 #endif /*]*/
 
     for (i = 0; i < maxROWS; i++) {
-	memmove(ea_save[scroll_max + i],
+	memmove(image_save + (i * maxCOLS),
 		(ea_buf + (i * COLS)), COLS * sizeof(struct ea));
     }
     need_saving = false;
@@ -357,12 +491,11 @@ sync_scroll(int sb)
     /* Update the screen. */
     for (i = 0; i < maxROWS; i++) {
 	if (i < sb) {
-	    memmove((ea_buf + (i * COLS)),
-		    ea_save[(scroll_first + i) % scroll_max],
-		    COLS * sizeof(struct ea));
+	    line_decode(line_save[(scroll_first + i) % scroll_max],
+		    ea_buf + (i * COLS), COLS);
 	} else {
 	    memmove((ea_buf + (i * COLS)),
-		    ea_save[scroll_max + i - sb],
+		    image_save + ((i - sb) * maxCOLS),
 		    COLS * sizeof(struct ea));
 	}
     }
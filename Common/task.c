@@ -92,6 +92,7 @@
 #include "w3misc.h"
 
 #define NVT_SAVE_SIZE	4096
+#define EXPECT_MAX_ALTS	16
 
 /* Maximum size of a macro. */
 #define MSC_BUF	1024
@@ -102,6 +103,17 @@
 /* Globals */
 struct macro_def *macro_defs = NULL;
 
+/*
+ * One Expect() alternative. It is matched incrementally as NVT characters
+ * are stored, using the Knuth-Morris-Pratt failure function.
+ */
+typedef struct {
+    char   *text;	/* text to match */
+    size_t  len;	/* length of text */
+    size_t *fail;	/* failure function */
+    size_t  state;	/* number of characters matched so far */
+} expect_alt_t;
+
 /* Statics */
 typedef struct task {
     /* Common fields. */
@@ -129,6 +141,7 @@ typedef struct task {
 	TS_WAIT_DISC,	/* awaiting completion of Wait(Disconnect) */
 	TS_WAIT_IFIELD,	/* awaiting completion of Wait(InputField) */
 	TS_WAIT_UNLOCK,	/* awaiting completion of Wait(Unlock) */
+	TS_WAIT_TEXT,	/* awaiting completion of Wait(Text) */
 	TS_EXPECTING,	/* awaiting completion of Expect() */
 	TS_PASSTHRU,	/* awaiting completion of a pass-through action */
 	TS_XWAIT	/* extended wait */
@@ -149,10 +162,22 @@ typedef struct task {
 
     /* Expect() fields. */
     struct {
-	char   *text;	/* text to match */
-	size_t	len;	/* length of match */
+	expect_alt_t *alts;	/* alternatives to match */
+	int	nalts;		/* number of alternatives */
+	int	matched;	/* index of matched alternative, or -1 */
+	size_t	after;		/* characters stored since the match */
     } expect;
 
+    /* Wait(Text) fields. */
+    struct {
+	ucs4_t	*text;		/* text to match */
+	int	len;		/* length of text, in characters */
+	int	row, col;	/* region origin (0-origin), or -1 for all */
+	int	rlen;		/* region length, or 0 to match at row,col */
+	bool	field;		/* region is the field containing row,col */
+	unsigned long serial;	/* change serial at last evaluation */
+    } wait_text;
+
     /* Macro fields. */
     struct {
 	char   *msc;	/* input buffer */
@@ -208,6 +233,7 @@ static const char *task_state_name[] = {
     "WAIT_DISC",
     "WAIT_IFIELD",
     "WAIT_UNLOCK",
+    "WAIT_TEXT",
     "EXPECTING",
     "PASSTHRU",
     "XWAIT"
@@ -217,6 +243,7 @@ static struct macro_def *macro_last = (struct macro_def *) NULL;
 static unsigned char *nvt_save_buf;
 static size_t   nvt_save_cnt = 0;
 static int      nvt_save_ix = 0;
+static int	expect_active = 0;	/* tasks with Expect() pending */
 static const char *st_name[NUM_ST] = {
     "Macro",		/* MACRO */
     "Callback"		/* CB */
@@ -235,6 +262,8 @@ static void task_pop(void);
 static void wait_timed_out(ioid_t id);
 static task_t *task_redirect_to(void);
 static bool expect_matches(task_t *task);
+static void expect_free(task_t *task);
+static bool wait_text_matches(task_t *task, bool force);
 
 /* Macro that defines that the keyboard is locked due to user input. */
 #define KBWAIT_MASK	(KL_OIA_LOCKED|KL_OIA_TWAIT|KL_DEFERRED_UNLOCK|KL_ENTER_INHIBIT|KL_AWAITING_FIRST)
@@ -572,6 +601,7 @@ new_task(enum task_type type, taskq_t *q)
     s->state = TS_IDLE;
     s->success = true;
     s->expect_id = NULL_IOID;
+    s->expect.matched = -1;
     s->wait_id = NULL_IOID;
     gettimeofday(&s->t0, NULL);
     s->child_msec = 0L;
@@ -647,7 +677,8 @@ free_task(task_t *t)
 
     /* Free auxiliary buffers. */
     Replace(t->macro.msc, NULL);
-    Replace(t->expect.text, NULL);
+    expect_free(t);
+    Replace(t->wait_text.text, NULL);
     
     /* Free the structure. */
     Free(t);
@@ -831,9 +862,8 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
     unsigned vbcount = 0;	/* allocated parameter count */
     varbuf_t *r = NULL;		/* accumulated parameters */
     int failreason = 0;
-    action_elt_t *e;
     action_elt_t *any = NULL;
-    action_elt_t *exact = NULL;
+    bool ambiguous;
     unsigned i;
     enum em_stat rc = EM_ERROR;	/* failure return code */
     char *s_orig = s;
@@ -1098,23 +1128,11 @@ success:
      * should be added that include the substitutions.
      */
 
-    /* Search the action list. */
-    FOREACH_LLIST(&actions_list, e, action_elt_t *) {
-	if (!strcasecmp(aname, e->t.name)) {
-	    exact = any = e;
-	    break;
-	}
-    } FOREACH_LLIST_END(&actions_list, e, action_elt_t *);
-    if (exact == NULL) {
-	FOREACH_LLIST(&actions_list, e, action_elt_t *) {
-	    if (!strncasecmp(aname, e->t.name, strlen(aname))) {
-		if (any != NULL) {
-		    popup_an_error("Ambiguous action name: %s", aname);
-		    goto silent_failure;
-		}
-		any = e;
-	    }
-	} FOREACH_LLIST_END(&actions_list, e, action_elt_t *);
+    /* Look up the action. */
+    any = lookup_action_prefix(aname, &ambiguous);
+    if (ambiguous) {
+	popup_an_error("Ambiguous action name: %s", aname);
+	goto silent_failure;
     }
 
     if (any != NULL) {
@@ -1821,6 +1839,17 @@ run_taskq(void)
 		return any;
 	    }
 
+	case TS_WAIT_TEXT:
+	    if (!PCONNECTED) {
+		task_disconnect_abort(current_task);
+		any = true;
+		break;
+	    }
+	    if (wait_text_matches(current_task, false)) {
+		break;
+	    }
+	    return any;
+
 	case TS_EXPECTING:
 	    if (!PCONNECTED) {
 		task_disconnect_abort(current_task);
@@ -1990,7 +2019,6 @@ dump_range(int first, int len, bool in_ascii, struct ea *buf,
 	if (in_ascii) {
 	    char mb[16];
 	    ucs4_t uc;
-	    size_t j;
 	    size_t xlen;
 
 	    if (buf[first + i].fa) {
@@ -2008,8 +2036,8 @@ dump_range(int first, int len, bool in_ascii, struct ea *buf,
 		    }
 		    xlen = unicode_to_multibyte_f(uc, mb, sizeof(mb),
 			    force_utf8);
-		    for (j = 0; j < xlen - 1; j++) {
-			vb_appendf(&r, "%c", mb[j]);
+		    if (xlen > 1) {
+			vb_append(&r, mb, xlen - 1);
 		    }
 		} else {
 		    /* 3270-mode text. */
@@ -2017,8 +2045,8 @@ dump_range(int first, int len, bool in_ascii, struct ea *buf,
 			xlen = ebcdic_to_multibyte_f((buf[first + i].ec << 8) |
 				buf[first + i + 1].ec,
 				mb, sizeof(mb), force_utf8);
-			for (j = 0; j < xlen - 1; j++) {
-			    vb_appendf(&r, "%c", mb[j]);
+			if (xlen > 1) {
+			    vb_append(&r, mb, xlen - 1);
 			}
 		    } else {
 			xlen = ebcdic_to_multibyte_fx(buf[first + i].ec,
@@ -2026,8 +2054,8 @@ dump_range(int first, int len, bool in_ascii, struct ea *buf,
 				EUO_BLANK_UNDEF |
 				 (toggled(MONOCASE)? EUO_TOUPPER: 0),
 				&uc, force_utf8);
-			for (j = 0; j < xlen - 1; j++) {
-			    vb_appendf(&r, "%c", mb[j]);
+			if (xlen > 1) {
+			    vb_append(&r, mb, xlen - 1);
 			}
 		    }
 		}
@@ -2530,8 +2558,8 @@ ReadBuffer_action(ia_t ia _is_unused, unsigned argc, const char **argv)
  * 10 cursor col
  * 11 main window id
  */
-static char *
-status_string(void)
+char *
+task_status_string(void)
 {
     char kb_stat;
     char fmt_stat;
@@ -2665,7 +2693,7 @@ task_cb_prompt(task_cbh handle)
 	return "???";
     }
 
-    st = status_string();
+    st = task_status_string();
     t = lazyaf("%s %ld.%03ld", st,
 	    s->child_msec / 1000L,
 	    s->child_msec % 1000L);
@@ -2699,12 +2727,14 @@ static int snap_cols = 0;
 static int snap_field_start = -1;
 static int snap_field_length = -1;
 static int snap_caddr = 0;
+static unsigned long snap_gen = 0;
+static uint64_t snap_hash = 0;
 
 static void
 snap_save(void)
 {
     set_output_needed(true);
-    Replace(snap_status, status_string());
+    Replace(snap_status, task_status_string());
 
     Replace(snap_buf, (struct ea *)Malloc(ROWS*COLS*sizeof(struct ea)));
     memcpy(snap_buf, ea_buf, ROWS*COLS*sizeof(struct ea));
@@ -2731,6 +2761,8 @@ snap_save(void)
 	} while (baddr != snap_field_start);
     }
     snap_caddr = cursor_addr;
+    snap_gen = ctlr_screen_generation();
+    snap_hash = ctlr_screen_hash();
 }
 
 /*
@@ -2742,6 +2774,8 @@ snap_save(void)
  *	returns the number of rows
  *  Snap Cols
  *	returns the number of columns
+ *  Snap ScreenGeneration
+ *	returns the screen generation number and content hash
  *  Snap Staus
  *  Snap Ascii ...
  *  Snap AsciiField (not yet)
@@ -2857,6 +2891,16 @@ Snap_action(ia_t ia _is_unused, unsigned argc, const char **argv)
 	    return false;
 	}
 	action_output("%d", snap_cols);
+    } else if (!strcasecmp(argv[0], KwScreenGeneration)) {
+	if (argc != 1) {
+	    popup_an_error(AnSnap "(): Extra argument(s)");
+	    return false;
+	}
+	if (snap_status == NULL) {
+	    popup_an_error(AnSnap "(): No saved state");
+	    return false;
+	}
+	action_output("%lu %016llx", snap_gen, (unsigned long long)snap_hash);
     } else if (!strcasecmp(argv[0], AnAscii)) {
 	if (snap_status == NULL) {
 	    popup_an_error(AnSnap "(): No saved state");
@@ -2893,10 +2937,223 @@ Snap_action(ia_t ia _is_unused, unsigned argc, const char **argv)
 	return do_read_buffer(argv + 1, argc - 1, snap_buf, IA_UTF8(ia));
     } else {
 	return action_args_are(AnSnap, KwSave, KwSnapStatus, KwRows, KwCols,
-		AnWait, AnAscii, AnAscii1, AnEbcdic, AnEbcdic1, AnReadBuffer,
-		NULL);
+		KwScreenGeneration, AnWait, AnAscii, AnAscii1, AnEbcdic,
+		AnEbcdic1, AnReadBuffer, NULL);
+	return false;
+    }
+    return true;
+}
+
+/*
+ * Translate 'len' screen positions starting at 'first' to Unicode, the way
+ * Ascii() does: field attributes and non-display fields become blanks, and
+ * the right halves of DBCS characters are skipped. The region wraps at the
+ * end of the screen.
+ *
+ * Returns the number of characters stored in 'u'.
+ */
+static int
+screen_to_unicode(int first, int len, ucs4_t *u)
+{
+    int size = ROWS * COLS;
+    int i;
+    int n = 0;
+    bool is_zero = FA_IS_ZERO(get_field_attribute(first));
+
+    for (i = 0; i < len; i++) {
+	int baddr = (first + i) % size;
+	ucs4_t uc;
+
+	if (ea_buf[baddr].fa) {
+	    is_zero = FA_IS_ZERO(ea_buf[baddr].fa);
+	    uc = ' ';
+	} else if (is_zero) {
+	    uc = ' ';
+	} else if (IS_RIGHT(ctlr_dbcs_state(baddr))) {
+	    continue;
+	} else if (is_nvt(&ea_buf[baddr], false, &uc)) {
+	    /* NVT-mode text. */
+	} else if (IS_LEFT(ctlr_dbcs_state(baddr))) {
+	    uc = ebcdic_base_to_unicode((ea_buf[baddr].ec << 8) |
+		    ea_buf[(baddr + 1) % size].ec, EUO_NONE);
+	} else {
+	    uc = ebcdic_to_unicode(ea_buf[baddr].ec, ea_buf[baddr].cs,
+		    EUO_NONE);
+	}
+	if (uc == 0) {
+	    uc = ' ';
+	} else if (toggled(MONOCASE)) {
+	    uc = u_toupper(uc);
+	}
+	u[n++] = uc;
+    }
+    return n;
+}
+
+/*
+ * Check a Wait(Text) for a match.
+ *
+ * Unless 'force' is set, the screen is only searched if the rows the region
+ * covers have changed since the last search.
+ */
+static bool
+wait_text_matches(task_t *task, bool force)
+{
+    int size = ROWS * COLS;
+    int first, len;
+    int first_row, last_row;
+    ucs4_t *u;
+    int n;
+    int i;
+    bool matched = false;
+
+    /* Figure out the region. */
+    if (task->wait_text.row < 0) {
+	first = 0;
+	len = size;
+    } else {
+	if (task->wait_text.row >= ROWS || task->wait_text.col >= COLS) {
+	    /* The screen has shrunk. */
+	    return false;
+	}
+	first = (task->wait_text.row * COLS) + task->wait_text.col;
+	if (task->wait_text.field) {
+	    int fa = find_field_attribute(first);
+
+	    if (fa < 0) {
+		/* Unformatted: the whole screen. */
+		first = 0;
+		len = size;
+	    } else {
+		first = (fa + 1) % size;
+		for (len = 0; len < size - 1; len++) {
+		    if (ea_buf[(first + len) % size].fa) {
+			break;
+		    }
+		}
+	    }
+	} else if (task->wait_text.rlen) {
+	    len = task->wait_text.rlen;
+	} else {
+	    /* Allow for DBCS characters taking two positions. */
+	    len = task->wait_text.len * 2;
+	}
+	if (len > size) {
+	    len = size;
+	}
+    }
+    if (len < task->wait_text.len) {
+	return false;
+    }
+    if (first + len > size) {
+	first_row = 0;
+	last_row = ROWS - 1;
+    } else {
+	first_row = first / COLS;
+	last_row = (first + len - 1) / COLS;
+    }
+
+    /* Skip the search if nothing there has changed. */
+    if (!force &&
+	!ctlr_rows_changed_since(first_row, last_row,
+	    task->wait_text.serial)) {
+	return false;
+    }
+    task->wait_text.serial = ctlr_change_serial();
+
+    /* Search. */
+    u = (ucs4_t *)Malloc(len * sizeof(ucs4_t));
+    n = screen_to_unicode(first, len, u);
+    if (task->wait_text.rlen == 0 && task->wait_text.row >= 0 &&
+	    !task->wait_text.field) {
+	/* Exact position. */
+	n = (n >= task->wait_text.len)? 1: 0;
+    } else {
+	n -= task->wait_text.len - 1;
+    }
+    for (i = 0; i < n; i++) {
+	if (!memcmp(u + i, task->wait_text.text,
+		    task->wait_text.len * sizeof(ucs4_t))) {
+	    matched = true;
+	    break;
+	}
+    }
+    Free(u);
+    if (matched) {
+	vtrace(AnWait "(" KwText "): matched at %d\n", (first + i) % size);
+    }
+    return matched;
+}
+
+/*
+ * Set up a Wait(Text).
+ *  Wait([timeout,]Text,string[,row,col[,length|Field]])
+ * Rows and columns are 1-origin. Without a row and column, the text can
+ * appear anywhere on the screen. With just a row and column, it must
+ * start there. With a length, it can appear anywhere in that many
+ * positions starting there, and with Field, anywhere in the field that
+ * contains that position.
+ */
+static bool
+wait_text_init(unsigned argc, const char **argv)
+{
+    int len;
+    int row = -1, col = -1;
+    int rlen = 0;
+    bool field = false;
+    ucs4_t *text;
+
+    if (argc != 1 && argc != 3 && argc != 4) {
+	popup_an_error(AnWait "(" KwText "): requires 1, 3 or 4 arguments");
+	return false;
+    }
+    if (!*argv[0]) {
+	popup_an_error(AnWait "(" KwText "): Empty text");
+	return false;
+    }
+    if (argc > 1) {
+	if (!is_all_digits(argv[1]) || !is_all_digits(argv[2]) ||
+		(row = atoi(argv[1]) - 1) < 0 || row >= ROWS ||
+		(col = atoi(argv[2]) - 1) < 0 || col >= COLS) {
+	    popup_an_error(AnWait "(" KwText "): Invalid row or column");
+	    return false;
+	}
+	if (argc > 3) {
+	    if (!strcasecmp(argv[3], KwField)) {
+		field = true;
+	    } else if (!is_all_digits(argv[3]) ||
+		    (rlen = atoi(argv[3])) <= 0 ||
+		    (row * COLS) + col + rlen > ROWS * COLS) {
+		popup_an_error(AnWait "(" KwText "): Invalid length");
+		return false;
+	    }
+	}
+    }
+
+    len = (int)strlen(argv[0]);
+    text = (ucs4_t *)Malloc(len * sizeof(ucs4_t));
+    len = multibyte_to_unicode_string(argv[0], strlen(argv[0]), text, len,
+	    false);
+    if (len <= 0) {
+	Free(text);
+	popup_an_error(AnWait "(" KwText "): Invalid text");
 	return false;
     }
+    if (toggled(MONOCASE)) {
+	int i;
+
+	for (i = 0; i < len; i++) {
+	    text[i] = u_toupper(text[i]);
+	}
+    }
+
+    Replace(current_task->wait_text.text, text);
+    current_task->wait_text.len = len;
+    current_task->wait_text.row = row;
+    current_task->wait_text.col = col;
+    current_task->wait_text.rlen = rlen;
+    current_task->wait_text.field = field;
+    current_task->wait_text.serial = 0;
     return true;
 }
 
@@ -2927,7 +3184,7 @@ Wait_action(ia_t ia _is_unused, unsigned argc, const char **argv)
 	pr = argv;
     }
 
-    if (np > 1) {
+    if (np > 1 && strcasecmp(pr[0], KwText)) {
 	popup_an_error("Too many arguments to " AnWait " ()"
 		"or invalid timeout value");
 	return false;
@@ -2936,7 +3193,12 @@ Wait_action(ia_t ia _is_unused, unsigned argc, const char **argv)
 	popup_an_error(AnWait "() can only be called from scripts or macros");
 	return false;
     }
-    if (np == 1) {
+    if (np > 0 && !strcasecmp(pr[0], KwText)) {
+	if (!wait_text_init(np - 1, pr + 1)) {
+	    return false;
+	}
+	next_state = TS_WAIT_TEXT;
+    } else if (np == 1) {
 	if (!strcasecmp(pr[0], KwNvtMode) || !strcasecmp(pr[0], KwAnsi)) {
 	    if (!IN_NVT) {
 		next_state = TS_WAIT_NVT;
@@ -2968,7 +3230,7 @@ Wait_action(ia_t ia _is_unused, unsigned argc, const char **argv)
 	    next_state = TS_TIME_WAIT;
 	} else if (strcasecmp(pr[0], KwInputField)) {
 	    return action_args_are(AnWait, KwInputField, KwNvtMode, Kw3270Mode,
-		    KwOutput, KwSeconds, KwDisconnect, KwUnlock, NULL);
+		    KwOutput, KwSeconds, KwDisconnect, KwUnlock, KwText, NULL);
 	}
     }
     if (next_state != TS_TIME_WAIT && !(CONNECTED || HALF_CONNECTED)) {
@@ -2980,6 +3242,10 @@ Wait_action(ia_t ia _is_unused, unsigned argc, const char **argv)
     if (next_state == TS_WAIT_IFIELD && CAN_PROCEED) {
 	return true;
     }
+    if (next_state == TS_WAIT_TEXT &&
+	    wait_text_matches(current_task, true)) {
+	return true;
+    }
 
     /* No, wait for it to happen. */
     task_set_state(current_task, next_state, AnWait "()");
@@ -3127,16 +3393,17 @@ task_active(void)
 
 /* Translate an expect string (uses C escape syntax). */
 static void
-expand_expect(task_t *task, const char *s)
+expand_expect(expect_alt_t *alt, const char *s)
 {
     char *t = Malloc(strlen(s) + 1);
     char c;
     enum { XS_BASE, XS_BS, XS_O, XS_X } state = XS_BASE;
     int n = 0;
     int nd = 0;
+    size_t i, k;
     static char hexes[] = "0123456789abcdef";
 
-    task->expect.text = t;
+    alt->text = t;
 
     while ((c = *s++)) {
 	switch (state) {
@@ -3209,56 +3476,175 @@ expand_expect(task_t *task, const char *s)
 	    break;
 	}
     }
-    task->expect.len = t - task->expect.text;
+    alt->len = t - alt->text;
+
+    /* Compute the failure function. */
+    alt->fail = (size_t *)Malloc((alt->len + 1) * sizeof(size_t));
+    alt->fail[0] = 0;
+    for (i = 1, k = 0; i < alt->len; i++) {
+	while (k > 0 && alt->text[i] != alt->text[k]) {
+	    k = alt->fail[k - 1];
+	}
+	if (alt->text[i] == alt->text[k]) {
+	    k++;
+	}
+	alt->fail[i] = k;
+    }
+    alt->state = 0;
 }
 
-/* 'mem' version of strstr */
-static char *
-memstr(char *s1, char *s2, int n1, int n2)
+/* Free the Expect() state for a task. */
+static void
+expect_free(task_t *task)
+{
+    int i;
+
+    if (task->expect.alts == NULL) {
+	return;
+    }
+    for (i = 0; i < task->expect.nalts; i++) {
+	Free(task->expect.alts[i].text);
+	Free(task->expect.alts[i].fail);
+    }
+    Replace(task->expect.alts, NULL);
+    task->expect.nalts = 0;
+    task->expect.matched = -1;
+    expect_active--;
+}
+
+/*
+ * Feed one NVT character to a task's Expect() alternatives.
+ * The first alternative to complete a match wins. After that, characters
+ * are only counted, so expect_matches() knows how many to leave in the
+ * buffer.
+ */
+static void
+expect_feed(task_t *task, unsigned char c)
 {
     int i;
 
-    for (i = 0; i <= n1 - n2; i++, s1++) {
-	if (*s1 == *s2 && !memcmp(s1, s2, n2)) {
-	    return s1;
+    if (task->expect.matched >= 0) {
+	task->expect.after++;
+	return;
+    }
+
+    for (i = 0; i < task->expect.nalts; i++) {
+	expect_alt_t *alt = &task->expect.alts[i];
+
+	if (alt->len == 0) {
+	    continue;
+	}
+	while (alt->state > 0 && (unsigned char)alt->text[alt->state] != c) {
+	    alt->state = alt->fail[alt->state - 1];
+	}
+	if ((unsigned char)alt->text[alt->state] == c) {
+	    alt->state++;
+	}
+	if (alt->state == alt->len) {
+	    alt->state = alt->fail[alt->len - 1];
+	    if (task->expect.matched < 0) {
+		task->expect.matched = i;
+		task->expect.after = 0;
+	    }
 	}
     }
-    return NULL;
 }
 
-/* Check for a match against an expect string. */
-static bool
-expect_matches(task_t *task)
+/* Match a task's Expect() alternatives against what is in the buffer now. */
+static void
+expect_scan(task_t *task)
 {
     size_t ix, i;
-    unsigned char buf[NVT_SAVE_SIZE];
-    char *t;
+
+    task->expect.matched = -1;
+    for (i = 0; i < (size_t)task->expect.nalts; i++) {
+	task->expect.alts[i].state = 0;
+	if (task->expect.alts[i].len == 0 && task->expect.matched < 0) {
+	    /* An empty string matches at the start of the buffer. */
+	    task->expect.matched = (int)i;
+	    task->expect.after = nvt_save_cnt;
+	}
+    }
+    if (task->expect.matched >= 0) {
+	return;
+    }
 
     ix = (nvt_save_ix + NVT_SAVE_SIZE - nvt_save_cnt) % NVT_SAVE_SIZE;
     for (i = 0; i < nvt_save_cnt; i++) {
-	buf[i] = nvt_save_buf[(ix + i) % NVT_SAVE_SIZE];
+	expect_feed(task, nvt_save_buf[(ix + i) % NVT_SAVE_SIZE]);
     }
-    t = memstr((char *)buf, task->expect.text, (int)nvt_save_cnt,
-	    (int)task->expect.len);
-    if (t != NULL) {
-	nvt_save_cnt -= ((unsigned char *)t - buf) + task->expect.len;
-	Replace(task->expect.text, NULL);
-	return true;
-    } else {
+}
+
+/* Rescan every pending Expect() after the buffer has been trimmed. */
+static void
+expect_rescan_all(void)
+{
+    taskq_t *q;
+    task_t *s;
+
+    if (!expect_active) {
+	return;
+    }
+    FOREACH_LLIST(&taskq, q, taskq_t *) {
+	for (s = q->top; s != NULL; s = s->next) {
+	    if (s->expect.alts != NULL) {
+		expect_scan(s);
+	    }
+	}
+    } FOREACH_LLIST_END(&taskq, q, taskq_t *);
+}
+
+/*
+ * Check for a match against an expect string.
+ * On a match, the buffer is trimmed to what followed it and, if there was
+ * more than one alternative, the number of the one that matched is output.
+ */
+static bool
+expect_matches(task_t *task)
+{
+    int matched = task->expect.matched;
+    int nalts = task->expect.nalts;
+
+    if (matched < 0) {
 	return false;
     }
+
+    if (task->expect.after < nvt_save_cnt) {
+	nvt_save_cnt = task->expect.after;
+    }
+    expect_free(task);
+    if (nalts > 1) {
+	action_output("%d", matched + 1);
+    }
+    expect_rescan_all();
+    return true;
 }
 
 /* Store an NVT character for use by the Expect action. */
 void
 task_store(unsigned char c)
 {
+    taskq_t *q;
+    task_t *s;
+
     /* Save the character in the buffer. */
     nvt_save_buf[nvt_save_ix++] = c;
     nvt_save_ix %= NVT_SAVE_SIZE;
     if (nvt_save_cnt < NVT_SAVE_SIZE) {
 	nvt_save_cnt++;
     }
+
+    /* Feed it to any pending Expect(). */
+    if (!expect_active) {
+	return;
+    }
+    FOREACH_LLIST(&taskq, q, taskq_t *) {
+	for (s = q->top; s != NULL; s = s->next) {
+	    if (s->expect.alts != NULL) {
+		expect_feed(s, c);
+	    }
+	}
+    } FOREACH_LLIST_END(&taskq, q, taskq_t *);
 }
 
 /* Dump whatever NVT data has been sent by the host since last called. */
@@ -3307,6 +3693,7 @@ NvtText_action(ia_t ia, unsigned argc, const char **argv)
     vb_free(&r);
     nvt_save_cnt = 0;
     nvt_save_ix = 0;
+    expect_rescan_all();
     return true;
 }
 
@@ -3382,7 +3769,7 @@ expect_timed_out(ioid_t id)
 	return;
     }
 
-    Replace(s->expect.text, NULL);
+    expect_free(s);
 
     current_task = s;
     popup_an_error(AnExpect "(): Timed out");
@@ -3437,14 +3824,22 @@ wait_timed_out(ioid_t id)
     s->wait_id = NULL_IOID;
 }
 
-/* Wait for a string from the host (NVT mode only). */
+/*
+ * Wait for a string from the host (NVT mode only).
+ *  Expect(text[,Or,text...][,timeout])
+ * With more than one text, the number of the one that matched (starting
+ * at 1) is output.
+ */
 static bool
 Expect_action(ia_t ia, unsigned argc, const char **argv)
 {
     int tmo;
+    const char *alts[EXPECT_MAX_ALTS];
+    unsigned nalts = 0;
+    unsigned i;
 
     action_debug(AnExpect, ia, argc, argv);
-    if (check_argc(AnExpect, argc, 1, 2) < 0) {
+    if (check_argc(AnExpect, argc, 1, EXPECT_MAX_ALTS * 2) < 0) {
 	return false;
     }
 
@@ -3453,10 +3848,23 @@ Expect_action(ia_t ia, unsigned argc, const char **argv)
 	popup_an_error(AnExpect "() is valid only when connected in NVT mode");
 	return false;
     }
-    if (argc == 2) {
-	tmo = atoi(argv[1]);
+    alts[nalts++] = argv[0];
+    for (i = 1; i + 1 < argc && !strcasecmp(argv[i], KwOr); i += 2) {
+	if (nalts >= EXPECT_MAX_ALTS) {
+	    popup_an_error(AnExpect "(): Too many strings (maximum %d)",
+		    EXPECT_MAX_ALTS);
+	    return false;
+	}
+	alts[nalts++] = argv[i + 1];
+    }
+    if (i + 1 < argc) {
+	popup_an_error(AnExpect "(): Extra argument(s)");
+	return false;
+    }
+    if (i < argc) {
+	tmo = atoi(argv[i]);
 	if (tmo < 1 || tmo > 600) {
-	    popup_an_error(AnExpect "(): Invalid timeout: %s", argv[1]);
+	    popup_an_error(AnExpect "(): Invalid timeout: %s", argv[i]);
 	    return false;
 	}
     } else {
@@ -3464,7 +3872,14 @@ Expect_action(ia_t ia, unsigned argc, const char **argv)
     }
 
     /* See if the text is there already; if not, wait for it. */
-    expand_expect(current_task, argv[0]);
+    current_task->expect.alts =
+	(expect_alt_t *)Calloc(nalts, sizeof(expect_alt_t));
+    current_task->expect.nalts = nalts;
+    for (i = 0; i < nalts; i++) {
+	expand_expect(&current_task->expect.alts[i], alts[i]);
+    }
+    expect_active++;
+    expect_scan(current_task);
     if (!expect_matches(current_task)) {
 	current_task->expect_id = AddTimeOut(tmo * 1000, expect_timed_out);
 	task_set_state(current_task, TS_EXPECTING, AnExpect "()");
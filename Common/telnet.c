@@ -41,6 +41,7 @@
 
 #if !defined(_WIN32) /*[*/
 # include <sys/ioctl.h>
+# include <sys/uio.h>
 # include <netinet/in.h>
 #endif /*]*/
 #define TELCMDS 1
@@ -107,6 +108,7 @@
 
 #define BUFSZ		32768
 #define TRACELINE	72
+#define NET_IOV_MAX	64	/* iovecs per writev() in net_output() */
 
 #define N_OPTS		256
 
@@ -132,6 +134,8 @@ bool		local_process = false;
 #endif /*]*/
 char           *termtype;
 struct timeval	net_last_recv_ts;
+bool		net_bulk_input = true;	/* IAC-scan fast path; bench3270
+					   turns it off for comparison */
 
 const char *telquals[3] = { "IS", "SEND", "INFO" };
 
@@ -148,6 +152,8 @@ static unsigned char *ibuf = (unsigned char *) NULL;
 			/* 3270 input buffer */
 static unsigned char *ibptr;
 static int      ibuf_size = 0;	/* size of ibuf */
+static unsigned ibuf_grows = 0;	/* ibuf reallocations, this record */
+static size_t	ibuf_moved = 0;	/* bytes moved by them */
 static unsigned char *obuf_base = NULL;
 static int	obuf_size = 0;
 static unsigned char *netrbuf = NULL;
@@ -217,7 +223,10 @@ static ntim_t parse_ntim(const char *value);
 static bool telnet_fsm(unsigned char c);
 static void net_rawout(unsigned const char *buf, size_t len);
 static void check_in3270(void);
+static void grow3270in(size_t need);
+static void end3270in(void);
 static void store3270in(unsigned char c);
+static void store3270in_n(const unsigned char *buf, size_t len);
 static void check_linemode(bool init);
 static int non_blocking(bool on);
 static void net_connected(void);
@@ -942,6 +951,8 @@ net_connected_complete(void)
     need_tls_follows = false;
     telnet_state = TNS_DATA;
     ibptr = ibuf;
+    ibuf_grows = 0;
+    ibuf_moved = 0;
 
     /* clear statistics and flags */
     time(&ns_time);
@@ -1239,6 +1250,76 @@ net_disconnect(bool including_tls)
     change_cstate(NOT_CONNECTED, "net_disconnect");
 }
 
+/*
+ * net_process_input
+ *	Process a buffer of data received from the host.
+ *	Returns false if the connection was dropped.
+ */
+bool
+net_process_input(unsigned char *buf, size_t nr)
+{
+    unsigned char *cp;
+
+    trace_netdata('<', buf, nr);
+
+    ns_brcvd += nr;
+    stats_poke();
+    for (cp = buf; cp < (buf + nr); cp++) {
+#if defined(LOCAL_PROCESS) /*[*/
+	if (local_process) {
+	    /* More to do here, probably. */
+	    if (cstate == TELNET_PENDING) {
+		host_in3270(linemode? CONNECTED_NVT: CONNECTED_NVT_CHAR);
+		hisopts[TELOPT_ECHO] = 1;
+		check_linemode(false);
+		kybdlock_clr(KL_AWAITING_FIRST, "telnet_fsm");
+		status_reset();
+		ps_process();
+	    }
+	    nvt_process((unsigned int) *cp);
+	} else {
+#endif /*]*/
+	    /*
+	     * Fast path: in the data state with 3270 (or TN3270E) data
+	     * arriving, everything up to the next IAC goes straight into
+	     * the 3270 input buffer. Only the IAC and what follows it go
+	     * through the state machine.
+	     */
+	    if (net_bulk_input &&
+		    telnet_state == TNS_DATA &&
+		    cstate != TELNET_PENDING &&
+		    !(IN_NVT && !IN_E)) {
+		size_t left = (buf + nr) - cp;
+		unsigned char *iac = NULL;
+		size_t run;
+
+		if (!HOST_FLAG(NO_TELNET_HOST)) {
+		    iac = memchr(cp, IAC, left);
+		}
+		run = (iac != NULL)? (size_t)(iac - cp): left;
+		if (run > 0) {
+		    store3270in_n(cp, run);
+		    cp += run - 1;
+		    continue;
+		}
+	    }
+	    if (!telnet_fsm(*cp)) {
+		ctlr_dbcs_postprocess();
+		host_disconnect(true);
+		return false;
+	    }
+#if defined(LOCAL_PROCESS) /*[*/
+	}
+#endif /*]*/
+    }
+
+    if (IN_NVT) {
+	ctlr_dbcs_postprocess();
+    }
+    net_nvt_break();
+    return true;
+}
+
 /*
  * net_input
  *	Called by the toolkit whenever there is input available on the
@@ -1248,7 +1329,6 @@ net_disconnect(bool including_tls)
 void
 net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 {
-    register unsigned char *cp;
     int	nr;
     bool ignore_tls = false;
 
@@ -1427,39 +1507,9 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	remove_output();
     }
 
-    trace_netdata('<', netrbuf, nr);
-
-    ns_brcvd += nr;
-    stats_poke();
-    for (cp = netrbuf; cp < (netrbuf + nr); cp++) {
-#if defined(LOCAL_PROCESS) /*[*/
-	if (local_process) {
-	    /* More to do here, probably. */
-	    if (cstate == TELNET_PENDING) {
-		host_in3270(linemode? CONNECTED_NVT: CONNECTED_NVT_CHAR);
-		hisopts[TELOPT_ECHO] = 1;
-		check_linemode(false);
-		kybdlock_clr(KL_AWAITING_FIRST, "telnet_fsm");
-		status_reset();
-		ps_process();
-	    }
-	    nvt_process((unsigned int) *cp);
-	} else {
-#endif /*]*/
-	    if (!telnet_fsm(*cp)) {
-		ctlr_dbcs_postprocess();
-		host_disconnect(true);
-		return;
-	    }
-#if defined(LOCAL_PROCESS) /*[*/
-	}
-#endif /*]*/
-    }
-
-    if (IN_NVT) {
-	ctlr_dbcs_postprocess();
+    if (!net_process_input(netrbuf, (size_t)nr)) {
+	return;
     }
-    net_nvt_break();
 
 #if defined(_WIN32) /*[*/
     if (events.lNetworkEvents & FD_CLOSE) {
@@ -1670,7 +1720,7 @@ telnet_fsm(unsigned char c)
 		Warning("EOR received when not in 3270 mode, ignored.");
 	    }
 	    vtrace("RCVD EOR\n");
-	    ibptr = ibuf;
+	    end3270in();
 	    telnet_state = TNS_DATA;
 	    break;
 	case WILL:
@@ -2675,6 +2725,29 @@ net_cookout(const char *buf, size_t len)
     }
 }
 
+/*
+ * net_write_error
+ *	Handle a failed write to the socket.
+ *	Returns true if the write should be retried, false if the connection
+ *	has been dropped.
+ */
+static bool
+net_write_error(void)
+{
+    vtrace("RCVD socket error %d (%s)\n", socket_errno(),
+	    socket_strerror(socket_errno()));
+    if (socket_errno() == SE_EPIPE || socket_errno() == SE_ECONNRESET) {
+	host_disconnect(false);
+	return false;
+    } else if (socket_errno() == SE_EINTR) {
+	return true;
+    } else {
+	popup_a_sockerr("Socket write");
+	host_disconnect(true);
+	return false;
+    }
+}
+
 /*
  * net_rawout
  *	Send out raw telnet data.  We assume that there will always be enough
@@ -2717,18 +2790,10 @@ net_rawout(unsigned const char *buf, size_t len)
 		host_disconnect(false);
 		return;
 	    }
-	    vtrace("RCVD socket error %d (%s)\n", socket_errno(),
-		    socket_strerror(socket_errno()));
-	    if (socket_errno() == SE_EPIPE || socket_errno() == SE_ECONNRESET) {
-		host_disconnect(false);
-		return;
-	    } else if (socket_errno() == SE_EINTR) {
+	    if (net_write_error()) {
 		goto bot;
-	    } else {
-		popup_a_sockerr("Socket write");
-		host_disconnect(true);
-		return;
 	    }
+	    return;
 	}
 	ns_bsent += nw;
 	stats_poke();
@@ -2744,6 +2809,41 @@ net_rawout(unsigned const char *buf, size_t len)
     }
 }
 
+#if !defined(_WIN32) /*[*/
+/*
+ * net_rawoutv
+ *	Send out raw telnet data held in several segments, with one writev()
+ *	per pass. Used only on unencrypted connections, and does not trace.
+ */
+static void
+net_rawoutv(struct iovec *iov, int iovcnt)
+{
+    while (iovcnt) {
+	ssize_t nw = writev(sock, iov, iovcnt);
+
+	if (nw < 0) {
+	    if (net_write_error()) {
+		continue;
+	    }
+	    return;
+	}
+	ns_bsent += (int)nw;
+	stats_poke();
+
+	/* Skip what was written. */
+	while (iovcnt && (size_t)nw >= iov->iov_len) {
+	    nw -= iov->iov_len;
+	    iov++;
+	    iovcnt--;
+	}
+	if (iovcnt) {
+	    iov->iov_base = (char *)iov->iov_base + nw;
+	    iov->iov_len -= nw;
+	}
+    }
+}
+#endif /*]*/
+
 /*
  * net_hexnvt_out_framed
  *	Send uncontrolled user data to the host in NVT mode, performing IAC
@@ -2882,6 +2982,47 @@ check_in3270(void)
     }
 }
 
+/*
+ * grow3270in
+ *	Expand the 3270 input buffer to hold at least <need> bytes. The size
+ *	doubles each time, so a large record costs a logarithmic number of
+ *	reallocations. The buffer is kept across records.
+ */
+static void
+grow3270in(size_t need)
+{
+    size_t nc = ibptr - ibuf;
+    size_t new_size = ibuf_size? (size_t)ibuf_size: BUFSIZ;
+
+    while (new_size < need) {
+	new_size *= 2;
+    }
+    ibuf = (unsigned char *)Realloc((char *)ibuf, new_size);
+    ibuf_size = (int)new_size;
+    ibptr = ibuf + nc;
+
+    ibuf_grows++;
+    ibuf_moved += nc;
+}
+
+/*
+ * end3270in
+ *	Finish a 3270 input record: trace any input buffer growth it caused
+ *	and empty the buffer for the next one.
+ */
+static void
+end3270in(void)
+{
+    if (ibuf_grows) {
+	vtrace("RCVD record of %u bytes: input buffer grew %u time%s, "
+		"%lu bytes moved\n", (unsigned)(ibptr - ibuf), ibuf_grows,
+		(ibuf_grows == 1)? "": "s", (unsigned long)ibuf_moved);
+	ibuf_grows = 0;
+	ibuf_moved = 0;
+    }
+    ibptr = ibuf;
+}
+
 /*
  * store3270in
  *	Store a character in the 3270 input buffer, checking for buffer
@@ -2891,39 +3032,56 @@ static void
 store3270in(unsigned char c)
 {
     if (ibptr - ibuf >= ibuf_size) {
-	ibuf_size += BUFSIZ;
-	ibuf = (unsigned char *)Realloc((char *)ibuf, ibuf_size);
-	ibptr = ibuf + ibuf_size - BUFSIZ;
+	grow3270in(ibuf_size + 1);
     }
     *ibptr++ = c;
 }
 
+/*
+ * store3270in_n
+ *	Store a run of characters in the 3270 input buffer, checking for
+ *	buffer overflow and reallocating ibuf if necessary.
+ */
+static void
+store3270in_n(const unsigned char *buf, size_t len)
+{
+    size_t nc = ibptr - ibuf;
+
+    if (nc + len > (size_t)ibuf_size) {
+	grow3270in(nc + len);
+    }
+    memcpy(ibptr, buf, len);
+    ibptr += len;
+}
+
 /*
  * space3270out
  *	Ensure that <n> more characters will fit in the 3270 output buffer.
- *	Allocates the buffer in BUFSIZ chunks.
+ *	Allocates the buffer in BUFSIZ chunks, doubling it as it grows.
  *	Allocates hidden space at the front of the buffer for TN3270E.
  */
 void
 space3270out(size_t n)
 {
     size_t nc = 0;	/* amount of data currently in obuf */
-    unsigned more = 0;
+    size_t new_size;
 
     if (obuf_size) {
 	nc = obptr - obuf;
     }
 
-    while ((nc + n + EH_SIZE) > (obuf_size + more)) {
-	more += BUFSIZ;
+    if ((nc + n + EH_SIZE) <= (size_t)obuf_size) {
+	return;
     }
 
-    if (more) {
-	obuf_size += more;
-	obuf_base = (unsigned char *)Realloc((char *)obuf_base, obuf_size);
-	obuf = obuf_base + EH_SIZE;
-	obptr = obuf + nc;
+    new_size = obuf_size? (size_t)obuf_size: BUFSIZ;
+    while ((nc + n + EH_SIZE) > new_size) {
+	new_size *= 2;
     }
+    obuf_size = (int)new_size;
+    obuf_base = (unsigned char *)Realloc((char *)obuf_base, obuf_size);
+    obuf = obuf_base + EH_SIZE;
+    obptr = obuf + nc;
 }
 
 /*
@@ -3032,7 +3190,7 @@ trace_netdata(char direction, unsigned const char *buf, size_t len)
 {
     size_t offset;
 
-    if (!toggled(TRACING)) {
+    if (!toggled(TRACING) || trace_netdata_binary(direction, buf, len)) {
 	    return;
     }
     for (offset = 0; offset < len; offset++) {
@@ -3051,14 +3209,26 @@ trace_netdata(char direction, unsigned const char *buf, size_t len)
  *	- Prepend TN3270E header
  *	- Expand IAC to IAC IAC
  *	- Append IAC EOR
+ *
+ *	IAC EOR is appended in place in obuf. A record with no IACs in it is
+ *	sent straight from obuf. Otherwise, on an unencrypted connection, the
+ *	IACs are doubled by sending each one twice from obuf via writev();
+ *	the record is only copied into an expanded buffer when that is not
+ *	possible, when it has too many IACs, or when tracing.
  */
 void
 net_output(void)
 {
     static unsigned char *xobuf = NULL;
-    static int xobuf_len = 0;
-    int need_resize = 0;
+    static size_t xobuf_len = 0;
+    unsigned char *start;
+    unsigned char *iac;
+    size_t len;
     unsigned char *nxoptr, *xoptr;
+#if !defined(_WIN32) /*[*/
+    static struct iovec iov[NET_IOV_MAX];
+    int iovcnt;
+#endif /*]*/
 
 #define BSTART	((IN_TN3270E || IN_SSCP)? obuf_base: obuf)
 
@@ -3087,29 +3257,75 @@ net_output(void)
 	}
     }
 
-    /* Reallocate the expanded output buffer. */
-    while (xobuf_len <  (obptr - BSTART + 1) * 2) {
-	xobuf_len += BUFSZ;
-	need_resize++;
+    /* Append the IAC EOR, without counting it as part of the record. */
+    space3270out(2);
+    obptr[0] = IAC;
+    obptr[1] = EOR;
+    start = BSTART;
+    len = obptr - start;
+
+    iac = memchr(start, IAC, len);
+    if (iac == NULL) {
+	/* Nothing to expand. */
+	net_rawout(start, len + 2);
+	goto done;
     }
-    if (need_resize) {
+
+#if !defined(_WIN32) /*[*/
+    if (!secure_connection && !toggled(TRACING)) {
+	unsigned char *pos = start;
+
+	/*
+	 * Each segment ends just after an IAC, and the next one starts on
+	 * the same IAC, so it goes out twice.
+	 */
+	iovcnt = 0;
+	while (iac != NULL && iovcnt < NET_IOV_MAX - 1) {
+	    iov[iovcnt].iov_base = (char *)pos;
+	    iov[iovcnt].iov_len = iac + 1 - pos;
+	    iovcnt++;
+	    pos = iac;
+	    iac = memchr(iac + 1, IAC, obptr - (iac + 1));
+	}
+	if (iac == NULL) {
+	    iov[iovcnt].iov_base = (char *)pos;
+	    iov[iovcnt].iov_len = obptr + 2 - pos;
+	    iovcnt++;
+	    net_rawoutv(iov, iovcnt);
+	    goto done;
+	}
+    }
+#endif /*]*/
+
+    /* Reallocate the expanded output buffer. */
+    if (xobuf_len < (len + 1) * 2) {
+	if (!xobuf_len) {
+	    xobuf_len = BUFSZ;
+	}
+	while (xobuf_len < (len + 1) * 2) {
+	    xobuf_len *= 2;
+	}
 	Replace(xobuf, (unsigned char *)Malloc(xobuf_len));
     }
 
     /* Copy and expand IACs. */
     xoptr = xobuf;
-    nxoptr = BSTART;
+    nxoptr = start;
     while (nxoptr < obptr) {
 	if ((*xoptr++ = *nxoptr++) == IAC) {
 	    *xoptr++ = IAC;
 	}
     }
+    vtrace("SENT record of %u bytes: copied to expand %u IAC%s\n",
+	    (unsigned)len, (unsigned)((xoptr - xobuf) - len),
+	    ((xoptr - xobuf) - len == 1)? "": "s");
 
     /* Append the IAC EOR and transmit. */
     *xoptr++ = IAC;
     *xoptr++ = EOR;
     net_rawout(xobuf, xoptr - xobuf);
 
+done:
     vtrace("SENT EOR\n");
     ns_rsent++;
     stats_poke();
@@ -43,6 +43,7 @@
 #include "ctlr.h"
 
 #include "actions.h"
+#include "bintrace.h"
 #include "codepage.h"
 #include "child.h"
 #include "ctlrc.h"
@@ -66,6 +67,7 @@
 #include "trace_gui.h"
 #include "utf8.h"
 #include "utils.h"
+#include "varbuf.h"
 #if defined(_WIN32) /*[*/
 # include "w3misc.h"
 # include "windirs.h"
@@ -81,6 +83,9 @@
 /* Maximum size of a tracefile header. */
 #define MAX_HEADER_SIZE		(32*1024)
 
+/* Amount of pending trace output that forces a write. */
+#define TRACE_FLUSH		(64*1024)
+
 /* Minimum size of a trace file. */
 #define MIN_TRACEFILE_SIZE	(64*1024)
 #define MIN_TRACEFILE_SIZE_NAME	"64K"
@@ -123,6 +128,21 @@ char	       *tracefile_name = NULL;
 
 /* Statics */
 static bool 	 wrote_ts = false;
+static varbuf_t	 trace_fmtbuf;	/* formatting work area */
+static varbuf_t	 trace_outbuf;	/* pending output */
+
+/* Binary trace state. */
+static bool	 trace_binary = false;	/* tracef is a binary trace */
+static uint64_t	 bt_start;		/* monotonic time the file started */
+static uint64_t	 bt_last_time;		/* time of the last record */
+static uint64_t	 bt_records;		/* text and data records written */
+static uint64_t	 bt_index_offset;	/* offset of the last index */
+static uint64_t	 bt_block_record;	/* first record since the last index */
+static uint64_t	 bt_block_time;		/*  its time */
+static uint64_t	 bt_block_offset;	/*  its offset */
+static varbuf_t	 bt_text;		/* text for the next text record */
+static int	 bt_text_type;		/*  its type */
+static uint64_t	 bt_text_time;		/*  its time */
 
 /* display a (row,col) */
 const char *
@@ -284,35 +304,277 @@ ntvtrace(const char *fmt, ...)
 static char *
 gen_ts(void)
 {
+    static char ts_buf[64];
+    static size_t ts_prefix_len = 0;
+    static time_t ts_sec = (time_t)-1;
     struct timeval tv;
-    time_t t;
-    struct tm *tm;
 
+    /* The date and time are only formatted once per second. */
     gettimeofday(&tv, NULL);
-    t = tv.tv_sec;
-    tm = localtime(&t);
-    return lazyaf("%d%02d%02d.%02d%02d%02d.%03d ",
-	    tm->tm_year + 1900,
-	    tm->tm_mon + 1,
-	    tm->tm_mday,
-	    tm->tm_hour,
-	    tm->tm_min,
-	    tm->tm_sec,
+    if (tv.tv_sec != ts_sec) {
+	time_t t = tv.tv_sec;
+	struct tm *tm = localtime(&t);
+
+	ts_prefix_len = snprintf(ts_buf, sizeof(ts_buf),
+		"%d%02d%02d.%02d%02d%02d.",
+		tm->tm_year + 1900,
+		tm->tm_mon + 1,
+		tm->tm_mday,
+		tm->tm_hour,
+		tm->tm_min,
+		tm->tm_sec);
+	ts_sec = tv.tv_sec;
+    }
+    snprintf(ts_buf + ts_prefix_len, sizeof(ts_buf) - ts_prefix_len, "%03d ",
 	    (int)(tv.tv_usec / 1000L));
+    return ts_buf;
+}
+
+/*
+ * Monotonic time for binary trace records, in microseconds.
+ */
+static uint64_t
+bt_now(void)
+{
+#if defined(_WIN32) /*[*/
+    LARGE_INTEGER count, freq;
+
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return ((uint64_t)(count.QuadPart / freq.QuadPart) * 1000000) +
+	((uint64_t)(count.QuadPart % freq.QuadPart) * 1000000) /
+	    freq.QuadPart;
+#elif defined(CLOCK_MONOTONIC) /*][*/
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000) + (ts.tv_nsec / 1000L);
+#else /*][*/
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return ((uint64_t)tv.tv_sec * 1000000) + tv.tv_usec;
+#endif /*]*/
+}
+
+/* Append a varint to the binary trace output. */
+static void
+bt_put_varint(uint64_t v)
+{
+    unsigned char buf[VARINT_MAX];
+    size_t len = varint_put(buf, v) - buf;
+
+    vb_append(&trace_outbuf, (char *)buf, len);
+    tracef_size += len;
+}
+
+/* Append a record to the binary trace output. */
+static void
+bt_record(int type, uint64_t now, const void *data, size_t len)
+{
+    char t = type;
+
+    if (type != BT_INDEX && type != BT_TRAILER &&
+	    bt_records == bt_block_record) {
+	bt_block_time = now;
+	bt_block_offset = tracef_size;
+    }
+
+    vb_append(&trace_outbuf, &t, 1);
+    tracef_size++;
+    bt_put_varint(len);
+    bt_put_varint(now - bt_last_time);
+    vb_append(&trace_outbuf, data, len);
+    tracef_size += len;
+    bt_last_time = now;
+}
+
+/* Write an index record for the records since the last one. */
+static void
+bt_index(void)
+{
+    unsigned char buf[BT_INDEX_LEN];
+    unsigned char *p = buf;
+    uint64_t offset = tracef_size;
+
+    if (bt_records == bt_block_record) {
+	return;
+    }
+    p = bt_put64(p, bt_index_offset);
+    p = bt_put64(p, bt_block_record);
+    p = bt_put64(p, bt_block_time);
+    bt_put64(p, bt_block_offset);
+    bt_record(BT_INDEX, bt_last_time, buf, sizeof(buf));
+    bt_index_offset = offset;
+    bt_block_record = bt_records;
+}
+
+/* Append a text or data record to the binary trace output. */
+static void
+bt_data_record(int type, uint64_t now, const void *data, size_t len)
+{
+    bt_record(type, now, data, len);
+    if (++bt_records - bt_block_record >= BT_INDEX_INTERVAL) {
+	bt_index();
+    }
+    if (vb_len(&trace_outbuf) >= TRACE_FLUSH) {
+	trace_flush();
+    }
+}
+
+/* Write out pending text. */
+static void
+bt_text_flush(void)
+{
+    if (vb_len(&bt_text)) {
+	bt_data_record(bt_text_type, bt_text_time, vb_buf(&bt_text),
+		vb_len(&bt_text));
+	vb_reset(&bt_text);
+    }
+}
+
+/*
+ * Add text to a binary trace.
+ * Text is collected into a record until a newline, so that the many small
+ * trace calls that make up one line do not each become a record.
+ */
+static void
+bt_add_text(int type, const char *text, size_t len)
+{
+    size_t n;
+
+    if (vb_len(&bt_text) && type != bt_text_type) {
+	bt_text_flush();
+    }
+    if (!vb_len(&bt_text)) {
+	bt_text_type = type;
+	bt_text_time = bt_now() - bt_start;
+    }
+
+    /* Find the last newline. */
+    for (n = len; n > 0 && text[n - 1] != '\n'; n--) {
+    }
+    if (n > 0) {
+	vb_append(&bt_text, text, n);
+	bt_text_flush();
+	text += n;
+	len -= n;
+	if (len > 0) {
+	    bt_text_time = bt_last_time;
+	}
+    }
+    vb_append(&bt_text, text, len);
+}
+
+/* Start a binary trace file. */
+static void
+bt_start_file(void)
+{
+    unsigned char buf[BT_HEADER_SIZE];
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    memcpy(buf, BT_MAGIC, BT_MAGIC_LEN);
+    buf[BT_MAGIC_LEN] = BT_VERSION;
+    bt_put64(buf + BT_MAGIC_LEN + 1,
+	    ((uint64_t)tv.tv_sec * 1000000) + tv.tv_usec);
+    vb_append(&trace_outbuf, (char *)buf, sizeof(buf));
+    tracef_size += sizeof(buf);
+
+    bt_start = bt_now();
+    bt_last_time = 0;
+    vb_reset(&bt_text);
+    bt_records = 0;
+    bt_index_offset = 0;
+    bt_block_record = 0;
+}
+
+/* Finish a binary trace file with a final index and the trailer. */
+static void
+bt_finish(void)
+{
+    unsigned char buf[BT_TRAILER_SIZE];
+    unsigned char *p = buf;
+
+    bt_text_flush();
+    bt_index();
+
+    /* The trailer has a fixed size, so its time delta is always 0. */
+    *p++ = BT_TRAILER;
+    *p++ = BT_TRAILER_LEN;
+    *p++ = 0;
+    p = bt_put64(p, bt_index_offset);
+    memcpy(p, BT_TRAILER_MAGIC, BT_MAGIC_LEN);
+    vb_append(&trace_outbuf, (char *)buf, sizeof(buf));
+    tracef_size += sizeof(buf);
+}
+
+/*
+ * Write network data to a binary trace.
+ * Returns true if the data was written, false if the caller should trace it
+ * as text.
+ */
+bool
+trace_netdata_binary(char direction, const unsigned char *buf, size_t len)
+{
+    if (!trace_binary || tracef == NULL || tracef_bufptr != NULL) {
+	return false;
+    }
+    bt_text_flush();
+    bt_data_record((direction == '<')? BT_NET_IN: BT_NET_OUT,
+	    bt_now() - bt_start, buf, len);
+    return true;
+}
+
+/*
+ * Write pending output to the trace file.
+ * Called once per pass through the event loop, and when the trace file is
+ * about to be closed.
+ */
+void
+trace_flush(void)
+{
+    size_t len = vb_len(&trace_outbuf);
+
+    if (tracef == NULL) {
+	vb_reset(&trace_outbuf);
+	return;
+    }
+    if (!len) {
+	return;
+    }
+
+    if (fwrite(vb_buf(&trace_outbuf), len, 1, tracef) != 1 ||
+	    fflush(tracef) != 0) {
+	int e = errno;
+
+	vb_reset(&trace_outbuf);
+	if (e != EPIPE && !IS_EILSEQ(e)) {
+	    popup_an_errno(e, "Write to trace file failed");
+	}
+	if (!IS_EILSEQ(e)) {
+	    stop_tracing();
+	}
+	return;
+    }
+    vb_reset(&trace_outbuf);
 }
 
 /*
  * Write to the trace file, varargs style.
  * This is the only function that actually does output to the trace file --
  * all others are wrappers around this function.
+ *
+ * Output is accumulated in trace_outbuf and written by trace_flush(), unless
+ * the trace is going to stdout, where it might be interleaved with other
+ * output. In a binary trace, text is collected into records a line at a
+ * time.
  */
 static void
 vwtrace(bool do_ts, const char *fmt, va_list args)
 {
-    size_t n2w_left, n2w, nw;
-    char *ts;
-    char *buf = NULL;
-    char *bp;
+    size_t n2w_left, n2w;
+    const char *bp;
 
     /* Ugly hack to write into a memory buffer. */
     if (tracef_bufptr != NULL) {
@@ -327,61 +589,48 @@ vwtrace(bool do_ts, const char *fmt, va_list args)
 	return;
     }
 
-    ts = NULL;
+    vb_reset(&trace_fmtbuf);
+    vb_vappendf(&trace_fmtbuf, fmt, args);
+    bp = vb_buf(&trace_fmtbuf);
+    n2w_left = strlen(bp);
 
-    buf = xs_vbuffer(fmt, args);
-    n2w_left = strlen(buf);
-    bp = buf;
+    if (trace_binary) {
+	if (n2w_left > 0) {
+	    bt_add_text(do_ts? BT_TEXT_TS: BT_TEXT, bp, n2w_left);
+	}
+	return;
+    }
 
+    /* Copy it to the output buffer, a line at a time. */
     while (n2w_left > 0) {
-	char *nl;
-	bool wrote_nl = false;
+	const char *nl;
 
 	if (do_ts && !wrote_ts) {
-	    if (ts == NULL) {
-		ts = gen_ts();
-	    }
-	    fwrite(ts, strlen(ts), 1, tracef);
-	    fflush(tracef);
+	    char *ts = gen_ts();
+	    size_t ts_len = strlen(ts);
+
+	    vb_append(&trace_outbuf, ts, ts_len);
+	    tracef_size += ts_len;
 	    wrote_ts = true;
 	}
 
-	nl = strchr(bp, '\n');
+	nl = memchr(bp, '\n', n2w_left);
 	if (nl != NULL) {
-	    wrote_nl = true;
 	    n2w = nl - bp + 1;
+	    wrote_ts = false;
 	} else {
 	    n2w = n2w_left;
 	}
-
-	nw = fwrite(bp, n2w, 1, tracef);
-	if (nw == 1) {
-	    fflush(tracef);
-	} else {
-	    if (errno != EPIPE && !IS_EILSEQ(errno)) {
-		popup_an_errno(errno, "Write to trace file failed");
-	    }
-	    if (!IS_EILSEQ(errno)) {
-		stop_tracing();
-		goto done;
-	    }
-	}
-
-	if (wrote_nl) {
-	    wrote_ts = false;
-	}
+	vb_append(&trace_outbuf, bp, n2w);
+	tracef_size += n2w;
 
 	bp += n2w;
 	n2w_left -= n2w;
     }
 
-    tracef_size = ftello(tracef);
-
-done:
-    if (buf != NULL) {
-	Free(buf);
+    if (tracef == stdout || vb_len(&trace_outbuf) >= TRACE_FLUSH) {
+	trace_flush();
     }
-    return;
 }
 
 /* Write to the trace file. */
@@ -404,6 +653,7 @@ stop_tracing(void)
 	fclose(tracef);
     }
     tracef = NULL;
+    trace_binary = false;
     if (toggled(TRACING)) {
 	toggle_toggle(TRACING);
 	menubar_retoggle(TRACING);
@@ -428,6 +678,13 @@ trace_rollover_check(void)
 
 	/* Close up this file. */
 	wtrace(true, "Trace rolled over\n");
+	if (trace_binary) {
+	    bt_finish();
+	}
+	trace_flush();
+	if (tracef == NULL) {
+	    return;
+	}
 	fclose(tracef);
 	tracef = NULL;
 
@@ -446,15 +703,19 @@ trace_rollover_check(void)
 	rename(tracefile_name, alt_filename);
 	Free(alt_filename);
 	alt_filename = NULL;
-	tracef = fopen(tracefile_name, "w");
+	tracef = fopen(tracefile_name, trace_binary? "wb": "w");
 	if (tracef == NULL) {
 	    popup_an_errno(errno, "%s", tracefile_name);
+	    trace_binary = false;
 	    return;
 	}
 
 	/* Initialize it. */
 	tracef_size = 0L;
 	SETLINEBUF(tracef);
+	if (trace_binary) {
+	    bt_start_file();
+	}
 	new_header = create_tracefile_header("rolled over");
 	wtrace(false, new_header);
 	Free(new_header);
@@ -794,14 +1055,20 @@ tracefile_ok(const char *tfn)
 	    append = true;
 	    tracef = fopen(stfn + 2, "a");
 	} else {
-	    tracef = fopen(stfn, "w");
+	    /* Only a new file can be written in binary. */
+	    trace_binary = appres.trace_binary;
+	    tracef = fopen(stfn, trace_binary? "wb": "w");
 	}
 	if (tracef == NULL) {
 	    popup_an_errno(errno, "%s", stfn);
+	    trace_binary = false;
 	    Free(stfn);
 	    goto done;
 	}
 	tracef_size = ftello(tracef);
+	if (trace_binary) {
+	    bt_start_file();
+	}
 	Replace(tracefile_name, NewString(append? stfn + 2: stfn));
 	SETLINEBUF(tracef);
 #if !defined(_WIN32) /*[*/
@@ -810,7 +1077,8 @@ tracefile_ok(const char *tfn)
     }
 
     /* Start the monitor window. */
-    if (tracef != stdout && appres.trace_monitor && product_has_display()) {
+    if (tracef != stdout && !trace_binary && appres.trace_monitor &&
+	    product_has_display()) {
 #if !defined(_WIN32) /*[*/
 	start_trace_window(stfn);
 #else /*][*/
@@ -900,6 +1168,10 @@ static void
 tracefile_off(void)
 {
     wtrace(true, "Trace stopped\n");
+    if (trace_binary) {
+	bt_finish();
+    }
+    trace_flush();
 #if !defined(_WIN32) /*[*/
     if (tracewindow_pid != -1) {
 	kill(tracewindow_pid, SIGKILL);
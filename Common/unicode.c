@@ -305,6 +305,36 @@ cpalias_t cpaliases[] = {
 
 static uni_t *cur_uni = NULL;
 
+/*
+ * Unicode-to-EBCDIC maps for the current code page and for APL, rebuilt by
+ * set_uni(). Both source tables hold only UCS-2 values, so each map is
+ * indexed by the high byte of a BMP code point, and points to a 256-byte
+ * page indexed by the low byte, or is NULL if nothing in that page maps.
+ * A zero entry means no mapping.
+ */
+static unsigned char *u2e_cur[256];
+static unsigned char *u2e_apl[256];
+static bool u2e_apl_built = false;
+
+/*
+ * SBCS EBCDIC-to-multibyte cache for the current code page and locale, used
+ * for base-character-set conversions with EUO_BLANK_UNDEF. It is indexed by
+ * [force_utf8][EUO_TOUPPER set][EBCDIC code], filled in the first time each
+ * variant is used, and emptied by set_uni().
+ */
+typedef struct {
+    char mb[8];		/* multibyte value, including the NUL */
+    unsigned char len;	/* length of mb[], or 0 if not cached */
+    ucs4_t ucs4;	/* Unicode value */
+} e2mb_t;
+static e2mb_t e2mb[2][2][256];
+static bool e2mb_valid[2][2];
+
+static size_t ebcdic_to_multibyte_xs(ebc_t ebc, unsigned char cs, char mb[],
+	size_t mb_len, unsigned flags, ucs4_t *ucp);
+static size_t ebcdic_to_utf8_x(ebc_t ebc, unsigned char cs, char mb[],
+	size_t mb_len, unsigned flags, ucs4_t *ucp);
+
 static void
 codepage_list_one(bool dbcs)
 {
@@ -442,6 +472,64 @@ ebcdic_base_to_unicode(ebc_t c, unsigned flags)
     }
 }
 
+/*
+ * Add a mapping to a Unicode-to-EBCDIC map. If a character appears more
+ * than once, the first (lowest) EBCDIC code is kept.
+ */
+static void
+u2e_add(unsigned char *map[], ucs4_t u, unsigned char e)
+{
+    unsigned char *page;
+
+    if (u == 0 || u > 0xffff) {
+	return;
+    }
+    page = map[u >> 8];
+    if (page == NULL) {
+	page = map[u >> 8] = (unsigned char *)Calloc(256, 1);
+    }
+    if (!page[u & 0xff]) {
+	page[u & 0xff] = e;
+    }
+}
+
+/* Look up a character in a Unicode-to-EBCDIC map. */
+static unsigned char
+u2e_find(unsigned char *map[], ucs4_t u)
+{
+    unsigned char *page;
+
+    if (u > 0xffff || (page = map[u >> 8]) == NULL) {
+	return 0;
+    }
+    return page[u & 0xff];
+}
+
+/* Rebuild the Unicode-to-EBCDIC maps after a code page change. */
+static void
+u2e_build(void)
+{
+    int i;
+
+    for (i = 0; i < 256; i++) {
+	Replace(u2e_cur[i], NULL);
+    }
+    for (i = 0; i < UT_SIZE; i++) {
+	u2e_add(u2e_cur, cur_uni->code[i], UT_OFFSET + i);
+    }
+
+    if (!u2e_apl_built) {
+	for (i = 0x70; i <= 0xfe; i++) {
+	    int u = apl_to_unicode(i, EUO_NONE);
+
+	    if (u > 0) {
+		u2e_add(u2e_apl, u, i);
+	    }
+	}
+	u2e_apl_built = true;
+    }
+}
+
 /*
  * Map a UCS-4 character to an EBCDIC character.
  * Returns 0 for failure, nonzero for success.
@@ -449,7 +537,7 @@ ebcdic_base_to_unicode(ebc_t c, unsigned flags)
 ebc_t
 unicode_to_ebcdic(ucs4_t u)
 {
-    int i;
+    ebc_t e;
     ebc_t d;
 
     if (!u) {
@@ -459,10 +547,9 @@ unicode_to_ebcdic(ucs4_t u)
 	return 0x40;
     }
 
-    for (i = 0; i < UT_SIZE; i++) {
-	if (cur_uni->code[i] == u) {
-	    return UT_OFFSET + i;
-	}
+    e = u2e_find(u2e_cur, u);
+    if (e) {
+	return e;
     }
     /* See if it's DBCS. */
     d = unicode_to_ebcdic_dbcs(u);
@@ -488,14 +575,7 @@ unicode_to_ebcdic_ge(ucs4_t u, bool *ge, bool prefer_apl)
     e_cur = unicode_to_ebcdic(u);
 
     /* Find the character in the APL code page. */
-    for (e_apl = 0x70; e_apl <= 0xfe; e_apl++) {
-	if ((ucs4_t)apl_to_unicode(e_apl, EUO_NONE) == u) {
-	    break;
-	}
-    }
-    if (e_apl > 0xfe) {
-	e_apl = 0;
-    }
+    e_apl = u2e_find(u2e_apl, u);
 
     if (e_apl != 0 && ((e_cur == 0) || prefer_apl)) {
 	*ge = true;
@@ -580,6 +660,8 @@ set_uni(const char *cpname, int local_cp _is_unused,
 	}
 	if (!strcasecmp(realname, uni[i].name)) {
 	    cur_uni = &uni[i];
+	    u2e_build();
+	    memset(e2mb_valid, 0, sizeof(e2mb_valid));
 	    *host_codepage = uni[i].host_codepage;
 	    *cgcsgid = uni[i].cgcsgid;
 	    if (realnamep != NULL) {
@@ -806,6 +888,59 @@ fail:
     return -1;
 }
 
+/*
+ * Translate an SBCS EBCDIC character to multi-byte from the e2mb cache,
+ * filling the cache if needed.
+ *
+ * Returns the length, including the NUL, or 0 if the character cannot be
+ * translated from the cache and the caller has to do it.
+ */
+static size_t
+e2mb_cached(ebc_t ebc, unsigned char cs, char mb[], size_t mb_len,
+	unsigned flags, ucs4_t *ucp, bool force_utf8)
+{
+    int upper = (flags & EUO_TOUPPER) != 0;
+    e2mb_t *e;
+
+    if (cs != CS_BASE || (ebc & 0xff00) || cur_uni == NULL ||
+	    (flags & ~EUO_TOUPPER) != EUO_BLANK_UNDEF) {
+	return 0;
+    }
+
+    if (!e2mb_valid[force_utf8][upper]) {
+	int i;
+
+	for (i = 0; i < 256; i++) {
+	    char xmb[16];
+	    ucs4_t uc = 0;
+	    size_t len;
+
+	    e = &e2mb[force_utf8][upper][i];
+	    len = force_utf8?
+		ebcdic_to_utf8_x(i, cs, xmb, sizeof(xmb), flags, &uc):
+		ebcdic_to_multibyte_xs(i, cs, xmb, sizeof(xmb), flags, &uc);
+	    if (len > 0 && len <= sizeof(e->mb)) {
+		memcpy(e->mb, xmb, len);
+		e->len = (unsigned char)len;
+		e->ucs4 = uc;
+	    } else {
+		e->len = 0;
+	    }
+	}
+	e2mb_valid[force_utf8][upper] = true;
+    }
+
+    e = &e2mb[force_utf8][upper][ebc];
+    if (e->len == 0 || e->len > mb_len || (force_utf8 && mb_len < 7)) {
+	return 0;
+    }
+    memcpy(mb, e->mb, e->len);
+    if (ucp != NULL) {
+	*ucp = e->ucs4;
+    }
+    return e->len;
+}
+
 /*
  * Translate an EBCDIC character to the current locale's multi-byte
  * representation.
@@ -830,6 +965,19 @@ fail:
 size_t
 ebcdic_to_multibyte_x(ebc_t ebc, unsigned char cs, char mb[],
 	size_t mb_len, unsigned flags, ucs4_t *ucp)
+{
+    size_t len = e2mb_cached(ebc, cs, mb, mb_len, flags, ucp, false);
+
+    if (len) {
+	return len;
+    }
+    return ebcdic_to_multibyte_xs(ebc, cs, mb, mb_len, flags, ucp);
+}
+
+/* Uncached version of ebcdic_to_multibyte_x. */
+static size_t
+ebcdic_to_multibyte_xs(ebc_t ebc, unsigned char cs, char mb[],
+	size_t mb_len, unsigned flags, ucs4_t *ucp)
 {
     ucs4_t uc;
 #if defined(_WIN32) /*[*/
@@ -992,29 +1140,42 @@ ebcdic_to_multibyte_fx(ebc_t ebc, unsigned char cs, char mb[], size_t mb_len,
 	unsigned flags, ucs4_t *ucp, bool force_utf8)
 {
     if (force_utf8) {
-	ucs4_t ucs4;
-	int len;
+	size_t len = e2mb_cached(ebc, cs, mb, mb_len, flags, ucp, true);
 
-	if (mb_len < 7) {
-	    mb[0] = '\0';
-	    return 1;
-	}
-	ucs4 = ebcdic_to_unicode(ebc, cs, flags);
-	if (ucs4 == 0 && (flags & EUO_BLANK_UNDEF) != 0) {
-	    ucs4 = ' ';
-	}
-	*ucp = ucs4;
-	len = unicode_to_utf8(ucs4, mb);
-	if (len < 0) {
-	    len = 0;
+	if (len) {
+	    return len;
 	}
-	mb[len++] = '\0';
-	return len;
+	return ebcdic_to_utf8_x(ebc, cs, mb, mb_len, flags, ucp);
     } else {
 	return ebcdic_to_multibyte_x(ebc, cs, mb, mb_len, flags, ucp);
     }
 }
 
+/* Translate an EBCDIC character to UTF-8, ignoring the locale. */
+static size_t
+ebcdic_to_utf8_x(ebc_t ebc, unsigned char cs, char mb[], size_t mb_len,
+	unsigned flags, ucs4_t *ucp)
+{
+    ucs4_t ucs4;
+    int len;
+
+    if (mb_len < 7) {
+	mb[0] = '\0';
+	return 1;
+    }
+    ucs4 = ebcdic_to_unicode(ebc, cs, flags);
+    if (ucs4 == 0 && (flags & EUO_BLANK_UNDEF) != 0) {
+	ucs4 = ' ';
+    }
+    *ucp = ucs4;
+    len = unicode_to_utf8(ucs4, mb);
+    if (len < 0) {
+	len = 0;
+    }
+    mb[len++] = '\0';
+    return len;
+}
+
 /*
  * Convert an EBCDIC string to a multibyte string.
  * Makes lots of assumptions: standard character set, EUO_BLANK_UNDEF.
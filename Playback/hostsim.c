@@ -0,0 +1,1163 @@
+/*
+ * Copyright (c) 2020 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Paul Mattes nor his contributors may be used
+ *       to endorse or promote products derived from this software without
+ *       specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Host simulator for x3270.
+ *
+ * Plays the host side of a trace file to any number of concurrent clients,
+ * so emulators can be load-tested without a real host. The trace is broken
+ * into transactions: an inbound record from the emulator, and the host
+ * records that followed it. Each client gets the host's initial output, and
+ * then each record it sends is answered with the response to the same AID on
+ * the same screen. The screen is identified by the last host record sent.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <arpa/telnet.h>
+#include <stdint.h>
+
+#include "bintrace.h"
+#include "tn3270e.h"
+
+#if !defined(TELOPT_TN3270E) /*[*/
+# define TELOPT_TN3270E	40
+#endif /*]*/
+
+#define PORT		4001
+#define BSIZE		16384
+#define SB_MAX		256	/* longest subnegotiation kept */
+#define TYPE_MAX	40	/* longest terminal type or LU name */
+
+#define NO_TRANS	(-1)	/* no response pending */
+#define MISS		(-2)	/* pending response is a keyboard restore */
+
+/* Classic TELNET options still to be agreed to. */
+#define WANT_DO_EOR	0x1
+#define WANT_WILL_EOR	0x2
+#define WANT_DO_BINARY	0x4
+#define WANT_WILL_BINARY 0x8
+#define WANT_ALL	0xf
+
+/* TELNET parser events. */
+#define TN_NONE		0	/* nothing yet */
+#define TN_RECORD	1	/* record complete (IAC EOR) */
+#define TN_CMD		2	/* WILL/WONT/DO/DONT */
+#define TN_SB		3	/* subnegotiation complete */
+
+/* TELNET parser. */
+typedef struct {
+    enum {
+	TS_DATA,		/* data */
+	TS_IAC,			/* got IAC */
+	TS_OPT,			/* got WILL/WONT/DO/DONT */
+	TS_SB,			/* in subnegotiation */
+	TS_SB_IAC		/* got IAC in subnegotiation */
+    } state;
+    int verb;			/* WILL/WONT/DO/DONT */
+    int opt;			/*  its option */
+    unsigned char *buf;		/* current record, unescaped */
+    size_t len;
+    size_t alloc;
+    unsigned char sb[SB_MAX];	/* current subnegotiation */
+    size_t sb_len;
+} tparse_t;
+
+/* A recorded host record. */
+typedef struct {
+    size_t offset;		/* offset in pool, escaped for the wire */
+    size_t len;			/* escaped length */
+    unsigned long hash;		/* hash of the unescaped data */
+} hrec_t;
+
+/* A recorded transaction. */
+typedef struct {
+    unsigned long screen;	/* screen the record was sent from */
+    unsigned char aid;		/* AID */
+    size_t first;		/* first host record of the response */
+    size_t count;		/* number of host records in the response */
+} trans_t;
+
+/* A client connection. */
+typedef struct {
+    int fd;
+    int id;
+    int in3270;			/* negotiation complete */
+    int tn3270e;		/* TN3270E negotiated */
+    int want;			/* WANT_xxx bits */
+    tparse_t tp;		/* input parser */
+    unsigned char ibuf[BSIZE];	/* input buffer */
+    size_t ilen;		/*  bytes in it */
+    size_t ipos;		/*  bytes parsed */
+    unsigned char *obuf;	/* output buffer */
+    size_t olen;		/*  bytes in it */
+    size_t oalloc;		/*  allocated size */
+    unsigned seq;		/* TN3270E sequence number */
+    unsigned long screen;	/* current screen */
+    int next;			/* next transaction in recorded order */
+    int pending;		/* transaction to answer, NO_TRANS or MISS */
+    uint64_t due;		/* when to answer it */
+    uint64_t last;		/* when the last answer was sent */
+    int dead;			/* connection is closed */
+} conn_t;
+
+char *me;
+static int verbose = 0;
+static int no_tn3270e = 0;
+static unsigned long latency_min = 0;	/* response latency, msec */
+static unsigned long latency_max = 0;
+static unsigned long think = 0;		/* minimum think time, msec */
+static volatile sig_atomic_t stop = 0;
+
+/* The script. */
+static unsigned char *pool = NULL;	/* host record data */
+static size_t pool_len = 0;
+static size_t pool_alloc = 0;
+static hrec_t *hrecs = NULL;		/* host records */
+static size_t n_hrecs = 0;
+static size_t hrecs_alloc = 0;
+static trans_t *trans = NULL;		/* transactions */
+static size_t n_trans = 0;
+static size_t trans_alloc = 0;
+static size_t init_count = 0;		/* host records before the first */
+static int *tx_hash = NULL;		/* (screen, AID) -> first transaction */
+static size_t tx_hash_size = 0;
+
+/* Trace loading state. */
+static tparse_t load_host;
+static tparse_t load_emul;
+static int load_e = 0;			/* records have TN3270E headers */
+static unsigned long load_screen = 0;	/* current screen */
+
+/* Connections. */
+static conn_t **conns = NULL;
+static size_t n_conns = 0;
+static size_t conns_alloc = 0;
+
+/* Statistics. */
+static unsigned long st_connections = 0;
+static unsigned long st_answered = 0;
+static unsigned long st_missed = 0;
+
+void
+usage(void)
+{
+    fprintf(stderr, "\
+usage: %s [-p port] [-l msec[,max-msec]] [-t msec] [-n] [-v] file\n\
+  -p port      listen on port (default %d)\n\
+  -l msec      delay each response by msec, or by a random time between\n\
+               msec and max-msec\n\
+  -t msec      hold input until msec after the last response (think time)\n\
+  -n           do not negotiate TN3270E\n\
+  -v           trace connections and unmatched input\n", me, PORT);
+    exit(1);
+}
+
+/* Grow a buffer. */
+static void *
+grow(void *buf, size_t *allocp, size_t need, size_t size)
+{
+    if (need <= *allocp) {
+	return buf;
+    }
+    while (*allocp < need) {
+	*allocp = *allocp? *allocp * 2: 256;
+    }
+    buf = realloc(buf, *allocp * size);
+    if (buf == NULL) {
+	perror("realloc");
+	exit(1);
+    }
+    return buf;
+}
+
+/* Current time in milliseconds. */
+static uint64_t
+now_ms(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return ((uint64_t)tv.tv_sec * 1000) + (tv.tv_usec / 1000);
+}
+
+/* Hash a record (FNV-1a). */
+static unsigned long
+hash(const unsigned char *buf, size_t len)
+{
+    unsigned long h = 2166136261UL;
+
+    while (len--) {
+	h = ((h ^ *buf++) * 16777619UL) & 0xffffffffUL;
+    }
+    return h;
+}
+
+/*
+ * Feed a byte to a TELNET parser.
+ * Returns a TN_xxx event.
+ */
+static int
+tn_byte(tparse_t *t, unsigned char c)
+{
+    switch (t->state) {
+    case TS_DATA:
+	if (c == IAC) {
+	    t->state = TS_IAC;
+	    break;
+	}
+	t->buf = grow(t->buf, &t->alloc, t->len + 1, 1);
+	t->buf[t->len++] = c;
+	break;
+    case TS_IAC:
+	t->state = TS_DATA;
+	switch (c) {
+	case IAC:
+	    t->buf = grow(t->buf, &t->alloc, t->len + 1, 1);
+	    t->buf[t->len++] = c;
+	    break;
+	case EOR:
+	    return TN_RECORD;
+	case WILL:
+	case WONT:
+	case DO:
+	case DONT:
+	    t->verb = c;
+	    t->state = TS_OPT;
+	    break;
+	case SB:
+	    t->sb_len = 0;
+	    t->state = TS_SB;
+	    break;
+	default:
+	    break;
+	}
+	break;
+    case TS_OPT:
+	t->opt = c;
+	t->state = TS_DATA;
+	return TN_CMD;
+    case TS_SB:
+	if (c == IAC) {
+	    t->state = TS_SB_IAC;
+	} else if (t->sb_len < SB_MAX) {
+	    t->sb[t->sb_len++] = c;
+	}
+	break;
+    case TS_SB_IAC:
+	if (c == SE) {
+	    t->state = TS_DATA;
+	    return TN_SB;
+	}
+	if (t->sb_len < SB_MAX) {
+	    t->sb[t->sb_len++] = c;
+	}
+	t->state = TS_SB;
+	break;
+    }
+    return TN_NONE;
+}
+
+/* Add a host record to the script. */
+static void
+load_host_record(const unsigned char *buf, size_t len)
+{
+    hrec_t *h;
+    size_t i;
+
+    hrecs = grow(hrecs, &hrecs_alloc, n_hrecs + 1, sizeof(hrec_t));
+    h = &hrecs[n_hrecs++];
+    h->offset = pool_len;
+    h->hash = hash(buf, len);
+    pool = grow(pool, &pool_alloc, pool_len + (len * 2), 1);
+    for (i = 0; i < len; i++) {
+	pool[pool_len++] = buf[i];
+	if (buf[i] == IAC) {
+	    pool[pool_len++] = IAC;
+	}
+    }
+    h->len = pool_len - h->offset;
+
+    if (n_trans) {
+	trans[n_trans - 1].count++;
+    } else {
+	init_count++;
+    }
+    load_screen = h->hash;
+}
+
+/* Add an emulator record to the script, starting a new transaction. */
+static void
+load_emul_record(const unsigned char *buf, size_t len)
+{
+    trans_t *t;
+
+    trans = grow(trans, &trans_alloc, n_trans + 1, sizeof(trans_t));
+    t = &trans[n_trans++];
+    t->screen = load_screen;
+    t->aid = buf[0];
+    t->first = n_hrecs;
+    t->count = 0;
+}
+
+/* Process data from a trace file. */
+static void
+load_data(int from_host, const unsigned char *buf, size_t len)
+{
+    tparse_t *t = from_host? &load_host: &load_emul;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+	switch (tn_byte(t, buf[i])) {
+	case TN_SB:
+	    /* TN3270E headers start once the functions are agreed to. */
+	    if (t->sb_len >= 3 &&
+		    t->sb[0] == TELOPT_TN3270E &&
+		    t->sb[1] == TN3270E_OP_FUNCTIONS &&
+		    t->sb[2] == TN3270E_OP_IS) {
+		load_e = 1;
+	    }
+	    break;
+	case TN_RECORD: {
+	    unsigned char *r = t->buf;
+	    size_t rlen = t->len;
+
+	    t->len = 0;
+	    if (load_e) {
+		if (rlen < EH_SIZE || r[0] != TN3270E_DT_3270_DATA) {
+		    break;
+		}
+		r += EH_SIZE;
+		rlen -= EH_SIZE;
+	    }
+	    if (rlen == 0) {
+		break;
+	    }
+	    if (from_host) {
+		load_host_record(r, rlen);
+	    } else {
+		load_emul_record(r, rlen);
+	    }
+	    break;
+	    }
+	default:
+	    break;
+	}
+    }
+}
+
+/* Load a text trace file. */
+static void
+load_text(FILE *f)
+{
+    static const char hexes[] = "0123456789abcdef";
+    char line[1024];
+    int bol = 1;
+
+    while (fgets(line, sizeof(line), f) != NULL) {
+	int was_bol = bol;
+	unsigned char data[sizeof(line) / 2];
+	size_t n = 0;
+	char *s;
+
+	bol = strchr(line, '\n') != NULL;
+	if (!was_bol ||
+		(line[0] != '<' && line[0] != '>') ||
+		strncmp(line + 1, " 0x", 3)) {
+	    continue;
+	}
+	(void) strtoul(line + 4, &s, 16);
+	while (*s == ' ' || *s == '\t') {
+	    s++;
+	}
+	while (s[0] && s[1] && strchr(hexes, s[0]) && strchr(hexes, s[1])) {
+	    data[n++] = ((strchr(hexes, s[0]) - hexes) << 4) |
+		(strchr(hexes, s[1]) - hexes);
+	    s += 2;
+	}
+	load_data(line[0] == '<', data, n);
+    }
+}
+
+/* Load a binary trace file. */
+static void
+load_binary(btrace_t *b)
+{
+    int rv;
+
+    while ((rv = bt_read(b)) > 0) {
+	if (b->type == BT_NET_IN || b->type == BT_NET_OUT) {
+	    load_data(b->type == BT_NET_IN, b->data, b->len);
+	}
+    }
+    if (rv < 0) {
+	fprintf(stderr, "%s: malformed trace file\n", me);
+	exit(1);
+    }
+}
+
+/* Hash slot for a screen and AID. */
+static size_t
+tx_slot(unsigned long screen, unsigned char aid)
+{
+    return ((screen ^ (aid * 0x9e3779b1UL)) & 0xffffffffUL) &
+	(tx_hash_size - 1);
+}
+
+/* Build the (screen, AID) lookup table. */
+static void
+index_trans(void)
+{
+    size_t i;
+
+    tx_hash_size = 16;
+    while (tx_hash_size < n_trans * 2) {
+	tx_hash_size *= 2;
+    }
+    tx_hash = malloc(tx_hash_size * sizeof(int));
+    if (tx_hash == NULL) {
+	perror("malloc");
+	exit(1);
+    }
+    for (i = 0; i < tx_hash_size; i++) {
+	tx_hash[i] = NO_TRANS;
+    }
+    for (i = 0; i < n_trans; i++) {
+	size_t slot = tx_slot(trans[i].screen, trans[i].aid);
+
+	while (tx_hash[slot] != NO_TRANS) {
+	    trans_t *t = &trans[tx_hash[slot]];
+
+	    if (t->screen == trans[i].screen && t->aid == trans[i].aid) {
+		break;
+	    }
+	    slot = (slot + 1) & (tx_hash_size - 1);
+	}
+	if (tx_hash[slot] == NO_TRANS) {
+	    tx_hash[slot] = (int)i;
+	}
+    }
+}
+
+/*
+ * Find the response to an AID. The next transaction in recorded order is
+ * preferred, so a trace that visits the same screen more than once is
+ * followed faithfully; otherwise, the first recorded use of the AID on the
+ * screen is used.
+ */
+static int
+find_trans(conn_t *c, unsigned char aid)
+{
+    size_t slot;
+
+    if ((size_t)c->next < n_trans &&
+	    trans[c->next].screen == c->screen &&
+	    trans[c->next].aid == aid) {
+	return c->next;
+    }
+    for (slot = tx_slot(c->screen, aid);
+	 tx_hash[slot] != NO_TRANS;
+	 slot = (slot + 1) & (tx_hash_size - 1)) {
+	trans_t *t = &trans[tx_hash[slot]];
+
+	if (t->screen == c->screen && t->aid == aid) {
+	    return tx_hash[slot];
+	}
+    }
+    return MISS;
+}
+
+/* Queue output for a connection. */
+static void
+conn_out(conn_t *c, const unsigned char *buf, size_t len)
+{
+    c->obuf = grow(c->obuf, &c->oalloc, c->olen + len, 1);
+    memcpy(c->obuf + c->olen, buf, len);
+    c->olen += len;
+}
+
+/* Queue a TELNET command. */
+static void
+conn_cmd(conn_t *c, int verb, int opt)
+{
+    unsigned char buf[3];
+
+    buf[0] = IAC;
+    buf[1] = verb;
+    buf[2] = opt;
+    conn_out(c, buf, sizeof(buf));
+}
+
+/* Queue a subnegotiation. */
+static void
+conn_sb(conn_t *c, const unsigned char *buf, size_t len)
+{
+    static unsigned char sb[] = { IAC, SB };
+    static unsigned char se[] = { IAC, SE };
+
+    conn_out(c, sb, sizeof(sb));
+    conn_out(c, buf, len);
+    conn_out(c, se, sizeof(se));
+}
+
+/* Queue a record, already escaped. */
+static void
+conn_record(conn_t *c, const unsigned char *buf, size_t len)
+{
+    static unsigned char eor[] = { IAC, EOR };
+
+    if (c->tn3270e) {
+	unsigned char hdr[EH_SIZE * 2];
+	size_t hlen = 0;
+	unsigned char sq[2];
+	int i;
+
+	hdr[hlen++] = TN3270E_DT_3270_DATA;
+	hdr[hlen++] = 0;
+	hdr[hlen++] = TN3270E_RSF_NO_RESPONSE;
+	sq[0] = (c->seq >> 8) & 0xff;
+	sq[1] = c->seq & 0xff;
+	for (i = 0; i < 2; i++) {
+	    hdr[hlen++] = sq[i];
+	    if (sq[i] == IAC) {
+		hdr[hlen++] = IAC;
+	    }
+	}
+	c->seq = (c->seq + 1) & 0xffff;
+	conn_out(c, hdr, hlen);
+    }
+    conn_out(c, buf, len);
+    conn_out(c, eor, sizeof(eor));
+}
+
+/* Write as much queued output as the socket will take. */
+static void
+conn_flush(conn_t *c)
+{
+    ssize_t nw;
+
+    if (c->dead || !c->olen) {
+	return;
+    }
+    nw = write(c->fd, c->obuf, c->olen);
+    if (nw < 0) {
+	if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+	    if (verbose) {
+		printf("%d: write: %s\n", c->id, strerror(errno));
+	    }
+	    c->dead = 1;
+	}
+	return;
+    }
+    memmove(c->obuf, c->obuf + nw, c->olen - nw);
+    c->olen -= nw;
+}
+
+/* Negotiation is complete. Send the host's initial output. */
+static void
+conn_start(conn_t *c)
+{
+    size_t i;
+
+    c->in3270 = 1;
+    c->screen = 0;
+    for (i = 0; i < init_count; i++) {
+	conn_record(c, pool + hrecs[i].offset, hrecs[i].len);
+	c->screen = hrecs[i].hash;
+    }
+    c->next = 0;
+    c->last = now_ms();
+    if (verbose) {
+	printf("%d: in %s mode\n", c->id, c->tn3270e? "TN3270E": "3270");
+    }
+}
+
+/* Send the response to an inbound record. */
+static void
+conn_respond(conn_t *c)
+{
+    if (c->pending == MISS) {
+	/* Write, keyboard restore. */
+	static unsigned char restore[] = { 0xf1, 0xc2 };
+
+	conn_record(c, restore, sizeof(restore));
+	st_missed++;
+    } else {
+	trans_t *t = &trans[c->pending];
+	size_t i;
+
+	for (i = t->first; i < t->first + t->count; i++) {
+	    conn_record(c, pool + hrecs[i].offset, hrecs[i].len);
+	    c->screen = hrecs[i].hash;
+	}
+	c->next = c->pending + 1;
+	st_answered++;
+    }
+    c->pending = NO_TRANS;
+    c->last = now_ms();
+}
+
+/* Process an inbound record. */
+static void
+conn_input_record(conn_t *c)
+{
+    unsigned char *r = c->tp.buf;
+    size_t len = c->tp.len;
+    uint64_t now;
+    uint64_t due;
+
+    c->tp.len = 0;
+    if (!c->in3270) {
+	return;
+    }
+    if (c->tn3270e) {
+	if (len < EH_SIZE || r[0] != TN3270E_DT_3270_DATA) {
+	    return;
+	}
+	r += EH_SIZE;
+	len -= EH_SIZE;
+    }
+    if (len == 0) {
+	return;
+    }
+
+    c->pending = find_trans(c, r[0]);
+    if (c->pending == MISS && verbose) {
+	printf("%d: no response recorded for AID 0x%02x on screen %08lx\n",
+		c->id, r[0], c->screen);
+    }
+
+    /* Schedule the response. */
+    now = now_ms();
+    due = now + latency_min;
+    if (latency_max > latency_min) {
+	due += (uint64_t)rand() % (latency_max - latency_min + 1);
+    }
+    if (c->last + think > due) {
+	due = c->last + think;
+    }
+    c->due = due;
+}
+
+/* Process a WILL/WONT/DO/DONT. */
+static void
+conn_negotiate(conn_t *c, int verb, int opt)
+{
+    switch (opt) {
+    case TELOPT_TN3270E:
+	if (verb == WILL) {
+	    static unsigned char send_dt[] = {
+		TELOPT_TN3270E, TN3270E_OP_SEND, TN3270E_OP_DEVICE_TYPE
+	    };
+
+	    conn_sb(c, send_dt, sizeof(send_dt));
+	} else if (verb == WONT && !c->in3270) {
+	    conn_cmd(c, DO, TELOPT_TTYPE);
+	}
+	return;
+    case TELOPT_TTYPE:
+	if (verb == WILL) {
+	    static unsigned char send_tt[] = { TELOPT_TTYPE, TELQUAL_SEND };
+
+	    conn_sb(c, send_tt, sizeof(send_tt));
+	} else if (verb == WONT) {
+	    if (verbose) {
+		printf("%d: terminal type refused\n", c->id);
+	    }
+	    c->dead = 1;
+	}
+	return;
+    case TELOPT_EOR:
+    case TELOPT_BINARY:
+	if (c->tn3270e) {
+	    break;
+	}
+	if (verb == WONT || verb == DONT) {
+	    if (verbose) {
+		printf("%d: %s refused\n", c->id,
+			(opt == TELOPT_EOR)? "EOR": "BINARY");
+	    }
+	    c->dead = 1;
+	    return;
+	}
+	if (opt == TELOPT_EOR) {
+	    c->want &= ~((verb == WILL)? WANT_WILL_EOR: WANT_DO_EOR);
+	} else {
+	    c->want &= ~((verb == WILL)? WANT_WILL_BINARY: WANT_DO_BINARY);
+	}
+	if (!c->want && !c->in3270) {
+	    conn_start(c);
+	}
+	return;
+    default:
+	break;
+    }
+
+    /* Refuse anything else. */
+    if (verb == WILL) {
+	conn_cmd(c, DONT, opt);
+    } else if (verb == DO) {
+	conn_cmd(c, WONT, opt);
+    }
+}
+
+/* Process a TN3270E subnegotiation. */
+static void
+conn_tn3270e(conn_t *c)
+{
+    unsigned char *sb = c->tp.sb;
+    size_t len = c->tp.sb_len;
+
+    if (len < 3) {
+	return;
+    }
+
+    if (sb[1] == TN3270E_OP_DEVICE_TYPE && sb[2] == TN3270E_OP_REQUEST) {
+	unsigned char reply[3 + TYPE_MAX + 1 + TYPE_MAX];
+	size_t rlen = 0;
+	size_t i;
+	size_t tlen = 0;
+	char lu[TYPE_MAX + 1];
+
+	/* Echo the type, and use the LU they asked for or make one up. */
+	reply[rlen++] = TELOPT_TN3270E;
+	reply[rlen++] = TN3270E_OP_DEVICE_TYPE;
+	reply[rlen++] = TN3270E_OP_IS;
+	for (i = 3;
+	     i < len &&
+		sb[i] != TN3270E_OP_CONNECT &&
+		sb[i] != TN3270E_OP_ASSOCIATE &&
+		tlen < TYPE_MAX;
+	     i++, tlen++) {
+	    reply[rlen++] = sb[i];
+	}
+	reply[rlen++] = TN3270E_OP_CONNECT;
+	if (i < len && sb[i] == TN3270E_OP_CONNECT && i + 1 < len) {
+	    size_t ll = len - (i + 1);
+
+	    if (ll > TYPE_MAX) {
+		ll = TYPE_MAX;
+	    }
+	    memcpy(lu, sb + i + 1, ll);
+	    lu[ll] = '\0';
+	} else {
+	    sprintf(lu, "SIM%05d", c->id % 100000);
+	}
+	memcpy(reply + rlen, lu, strlen(lu));
+	rlen += strlen(lu);
+	conn_sb(c, reply, rlen);
+	c->tn3270e = 1;
+	return;
+    }
+
+    if (sb[1] == TN3270E_OP_FUNCTIONS && sb[2] == TN3270E_OP_REQUEST) {
+	unsigned char reply[SB_MAX];
+	size_t rlen = 3;
+	size_t i;
+	int subset = 1;
+
+	/* RESPONSES is the only function we are willing to do. */
+	reply[0] = TELOPT_TN3270E;
+	reply[1] = TN3270E_OP_FUNCTIONS;
+	for (i = 3; i < len; i++) {
+	    if (sb[i] == TN3270E_FUNC_RESPONSES) {
+		reply[rlen++] = sb[i];
+	    } else {
+		subset = 0;
+	    }
+	}
+	reply[2] = subset? TN3270E_OP_IS: TN3270E_OP_REQUEST;
+	conn_sb(c, reply, rlen);
+	if (subset && !c->in3270) {
+	    conn_start(c);
+	}
+	return;
+    }
+
+    if (sb[1] == TN3270E_OP_FUNCTIONS && sb[2] == TN3270E_OP_IS &&
+	    !c->in3270) {
+	conn_start(c);
+    }
+}
+
+/* Process a subnegotiation. */
+static void
+conn_subneg(conn_t *c)
+{
+    if (c->tp.sb_len == 0) {
+	return;
+    }
+    switch (c->tp.sb[0]) {
+    case TELOPT_TN3270E:
+	conn_tn3270e(c);
+	break;
+    case TELOPT_TTYPE:
+	if (c->tp.sb_len >= 2 && c->tp.sb[1] == TELQUAL_IS && !c->want) {
+	    conn_cmd(c, DO, TELOPT_EOR);
+	    conn_cmd(c, WILL, TELOPT_EOR);
+	    conn_cmd(c, DO, TELOPT_BINARY);
+	    conn_cmd(c, WILL, TELOPT_BINARY);
+	    c->want = WANT_ALL;
+	}
+	break;
+    default:
+	break;
+    }
+}
+
+/* Parse buffered input, stopping when a response is pending. */
+static void
+conn_process(conn_t *c)
+{
+    while (!c->dead && c->pending == NO_TRANS && c->ipos < c->ilen) {
+	switch (tn_byte(&c->tp, c->ibuf[c->ipos++])) {
+	case TN_RECORD:
+	    conn_input_record(c);
+	    break;
+	case TN_CMD:
+	    conn_negotiate(c, c->tp.verb, c->tp.opt);
+	    break;
+	case TN_SB:
+	    conn_subneg(c);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+/* Read from a connection. */
+static void
+conn_read(conn_t *c)
+{
+    ssize_t nr;
+
+    nr = read(c->fd, c->ibuf, sizeof(c->ibuf));
+    if (nr < 0) {
+	if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+	    if (verbose) {
+		printf("%d: read: %s\n", c->id, strerror(errno));
+	    }
+	    c->dead = 1;
+	}
+	return;
+    }
+    if (nr == 0) {
+	c->dead = 1;
+	return;
+    }
+    c->ilen = nr;
+    c->ipos = 0;
+    conn_process(c);
+}
+
+/* Accept new connections. */
+static void
+accept_all(int s)
+{
+    for (;;) {
+	union {
+	    struct sockaddr sa;
+	    struct sockaddr_in6 sin6;
+	} addr;
+	socklen_t len = sizeof(addr);
+	int fd;
+	int one = 1;
+	conn_t *c;
+
+	fd = accept(s, &addr.sa, &len);
+	if (fd < 0) {
+	    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+		perror("accept");
+	    }
+	    return;
+	}
+	if (fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) < 0) {
+	    perror("fcntl");
+	    close(fd);
+	    continue;
+	}
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (char *)&one, sizeof(one));
+
+	c = calloc(1, sizeof(conn_t));
+	if (c == NULL) {
+	    perror("calloc");
+	    exit(1);
+	}
+	c->fd = fd;
+	c->id = (int)++st_connections;
+	c->pending = NO_TRANS;
+	conns = grow(conns, &conns_alloc, n_conns + 1, sizeof(conn_t *));
+	conns[n_conns++] = c;
+	if (verbose) {
+	    char buf[INET6_ADDRSTRLEN];
+	    const char *a;
+
+	    a = inet_ntop(AF_INET6, &addr.sin6.sin6_addr, buf, sizeof(buf));
+	    if (a == NULL) {
+		a = "?";
+	    } else if (IN6_IS_ADDR_V4MAPPED(&addr.sin6.sin6_addr)) {
+		a += 7;		/* skip "::ffff:" */
+	    }
+	    printf("%d: connection from %s, port %u\n", c->id, a,
+		    ntohs(addr.sin6.sin6_port));
+	}
+
+	if (no_tn3270e) {
+	    conn_cmd(c, DO, TELOPT_TTYPE);
+	} else {
+	    conn_cmd(c, DO, TELOPT_TN3270E);
+	}
+	conn_flush(c);
+    }
+}
+
+/* Free a closed connection. */
+static void
+conn_free(conn_t *c)
+{
+    if (verbose) {
+	printf("%d: closed\n", c->id);
+    }
+    close(c->fd);
+    free(c->tp.buf);
+    free(c->obuf);
+    free(c);
+}
+
+static void
+catch_stop(int sig)
+{
+    stop = 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int c;
+    char *ptr;
+    FILE *f;
+    btrace_t bt;
+    int s;
+    struct sockaddr_in6 sin6;
+    int one = 1;
+    int port = PORT;
+    unsigned long l;
+    struct pollfd *pfds = NULL;
+    size_t pfds_alloc = 0;
+
+    /* Parse command-line arguments */
+    if ((me = strrchr(argv[0], '/')) != NULL) {
+	me++;
+    } else {
+	me = argv[0];
+    }
+
+    while ((c = getopt(argc, argv, "l:np:t:v")) != -1) {
+	switch (c) {
+	case 'l':
+	    latency_min = strtoul(optarg, &ptr, 10);
+	    latency_max = latency_min;
+	    if (*ptr == ',') {
+		latency_max = strtoul(ptr + 1, &ptr, 10);
+	    }
+	    if (ptr == optarg || *ptr || latency_max < latency_min) {
+		usage();
+	    }
+	    break;
+	case 'n':
+	    no_tn3270e = 1;
+	    break;
+	case 'p':
+	    l = strtoul(optarg, &ptr, 10);
+	    if (ptr == optarg || *ptr || l < 1 || l > 0xffff) {
+		usage();
+	    }
+	    port = (int)l;
+	    break;
+	case 't':
+	    think = strtoul(optarg, &ptr, 10);
+	    if (ptr == optarg || *ptr) {
+		usage();
+	    }
+	    break;
+	case 'v':
+	    verbose = 1;
+	    break;
+	default:
+	    usage();
+	}
+    }
+
+    if (argc - optind != 1) {
+	usage();
+    }
+
+    /* Load the trace. */
+    f = fopen(argv[optind], "rb");
+    if (f == NULL) {
+	perror(argv[optind]);
+	exit(1);
+    }
+    if (bt_open(&bt, f)) {
+	load_binary(&bt);
+    } else {
+	load_text(f);
+    }
+    fclose(f);
+    if (!n_hrecs) {
+	fprintf(stderr, "%s: no 3270 host data in %s\n", me, argv[optind]);
+	exit(1);
+    }
+    index_trans();
+    printf("%lu host records, %lu transactions.\n", (unsigned long)n_hrecs,
+	    (unsigned long)n_trans);
+
+    /* Listen. */
+    s = socket(AF_INET6, SOCK_STREAM, 0);
+    if (s < 0) {
+	perror("socket");
+	exit(1);
+    }
+    if (setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (char *)&one,
+		sizeof(one)) < 0) {
+	perror("setsockopt");
+	exit(1);
+    }
+    memset(&sin6, 0, sizeof(sin6));
+    sin6.sin6_family = AF_INET6;
+    sin6.sin6_port = htons(port);
+    if (bind(s, (struct sockaddr *)&sin6, sizeof(sin6)) < 0) {
+	perror("bind");
+	exit(1);
+    }
+    if (listen(s, SOMAXCONN) < 0) {
+	perror("listen");
+	exit(1);
+    }
+    if (fcntl(s, F_SETFL, fcntl(s, F_GETFL) | O_NONBLOCK) < 0) {
+	perror("fcntl");
+	exit(1);
+    }
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, catch_stop);
+    signal(SIGTERM, catch_stop);
+    printf("Listening on port %u.\n", port);
+    fflush(stdout);
+
+    /* Run. */
+    while (!stop) {
+	uint64_t now = now_ms();
+	int timeout = -1;
+	size_t i, j;
+	int ns;
+
+	/* Set up the poll, and find the next response that is due. */
+	pfds = grow(pfds, &pfds_alloc, n_conns + 1, sizeof(struct pollfd));
+	pfds[0].fd = s;
+	pfds[0].events = POLLIN;
+	for (i = 0; i < n_conns; i++) {
+	    conn_t *cn = conns[i];
+
+	    pfds[i + 1].fd = cn->fd;
+	    pfds[i + 1].events = 0;
+	    if (cn->pending == NO_TRANS) {
+		pfds[i + 1].events |= POLLIN;
+	    } else {
+		int t = (cn->due > now)? (int)(cn->due - now): 0;
+
+		if (timeout < 0 || t < timeout) {
+		    timeout = t;
+		}
+	    }
+	    if (cn->olen) {
+		pfds[i + 1].events |= POLLOUT;
+	    }
+	}
+
+	ns = poll(pfds, n_conns + 1, timeout);
+	if (ns < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    perror("poll");
+	    exit(1);
+	}
+
+	/* Handle I/O and due responses. */
+	now = now_ms();
+	for (i = 0; i < n_conns; i++) {
+	    conn_t *cn = conns[i];
+	    short revents = pfds[i + 1].revents;
+
+	    if (revents & POLLIN) {
+		conn_read(cn);
+	    } else if (revents & (POLLERR | POLLHUP | POLLNVAL)) {
+		cn->dead = 1;
+	    }
+	    if (!cn->dead && cn->pending != NO_TRANS && cn->due <= now) {
+		conn_respond(cn);
+		conn_process(cn);
+	    }
+	    conn_flush(cn);
+	}
+	if (pfds[0].revents & POLLIN) {
+	    accept_all(s);
+	}
+
+	/* Clean up closed connections. */
+	for (i = j = 0; i < n_conns; i++) {
+	    if (conns[i]->dead) {
+		conn_free(conns[i]);
+	    } else {
+		conns[j++] = conns[i];
+	    }
+	}
+	n_conns = j;
+	if (verbose) {
+	    fflush(stdout);
+	}
+    }
+
+    printf("\n%lu connections, %lu responses, %lu unmatched.\n",
+	    st_connections, st_answered, st_missed);
+    return 0;
+}
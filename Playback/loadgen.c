@@ -0,0 +1,835 @@
+/*
+ * Copyright (c) 2020 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Paul Mattes nor his contributors may be used
+ *       to endorse or promote products derived from this software without
+ *       specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Load generator for x3270.
+ *
+ * Runs a number of virtual terminals, each an s3270 process, through an
+ * action script, and reports response times, throughput and errors.
+ *
+ * After each line of the script, the terminal is asked for
+ * Query(ResponseTime), which counts the host operations it has completed
+ * (AID to keyboard unlock) and gives the time the last one took. A line that
+ * moves the count on is a transaction.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include <stdint.h>
+
+#define EMULATOR	"s3270"
+#define RBSIZE		4096
+#define HIST_WIDTH	50	/* widest histogram bar */
+
+/* Terminal states. */
+typedef enum {
+    T_WAITING,			/* not started yet */
+    T_RUNNING,			/* running a script line */
+    T_THINKING,			/* waiting for think time */
+    T_QUITTING,			/* sent Quit() */
+    T_DONE			/* finished */
+} tstate_t;
+
+/* A virtual terminal. */
+typedef struct {
+    int id;
+    tstate_t state;
+    pid_t pid;
+    int to;			/* pipe to the emulator */
+    int from;			/* pipe from the emulator */
+    char rbuf[RBSIZE];		/* partial line from the emulator */
+    size_t rlen;
+    char data[RBSIZE];		/* last 'data:' line */
+    size_t line;		/* next script line */
+    uint64_t wake;		/* when to start or stop thinking */
+    uint64_t sent;		/* when the current line was sent */
+    unsigned long txn_count;	/* last ResponseTime count */
+} term_t;
+
+/* Error kinds. */
+#define E_ACTION	0	/* action failed */
+#define E_TIMEOUT	1	/* action timed out */
+#define E_EXIT		2	/* emulator exited */
+#define E_NUM		3
+static const char *error_names[E_NUM] = {
+    "action failures", "timeouts", "emulator exits"
+};
+
+/* Per-interval counts. */
+typedef struct {
+    unsigned long txns;
+    unsigned long errors;
+    uint64_t usec;		/* total response time */
+} interval_t;
+
+/* Response time histogram buckets, upper bounds in usec. */
+static const unsigned long buckets[] = {
+    1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000,
+    1000000, 2000000, 5000000, 10000000
+};
+#define N_BUCKETS	(sizeof(buckets) / sizeof(buckets[0]))
+
+char *me;
+static int n_terms = 1;
+static unsigned long duration = 0;	/* seconds, 0 for one pass */
+static unsigned long ramp = 0;		/* msec between terminal starts */
+static unsigned long think_min = 0;	/* msec after each transaction */
+static unsigned long think_max = 0;
+static unsigned long timeout = 30;	/* seconds per script line */
+static unsigned long interval = 1;	/* seconds per report interval */
+static char *emulator = EMULATOR;
+static int verbose = 0;
+static volatile sig_atomic_t stop = 0;
+
+/* The script. */
+static char **script = NULL;
+static size_t n_script = 0;
+
+/* Results. */
+static unsigned long *samples = NULL;	/* response times, usec */
+static size_t n_samples = 0;
+static size_t samples_alloc = 0;
+static interval_t *intervals = NULL;
+static size_t n_intervals = 0;
+static unsigned long errors[E_NUM];
+static uint64_t t_start;
+
+void
+usage(void)
+{
+    fprintf(stderr, "\
+usage: %s [options] script [--] [emulator-options] host\n", me);
+    fprintf(stderr, "\
+  -n count     run count terminals (default 1)\n\
+  -d seconds   repeat the script for seconds (default: run it once)\n\
+  -r msec      start a terminal every msec\n\
+  -t msec[,max-msec]\n\
+               think time after each transaction, fixed or random\n");
+    fprintf(stderr, "\
+  -w seconds   time limit for each script line (default %lu)\n\
+  -i seconds   throughput report interval (default %lu)\n\
+  -e path      emulator to run (default %s)\n\
+  -v           display errors as they happen\n\
+Script lines are emulator actions. Think(msec[,max-msec]) pauses.\n",
+	    timeout, interval, EMULATOR);
+    exit(1);
+}
+
+/* Current time in microseconds. */
+static uint64_t
+now_us(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return ((uint64_t)tv.tv_sec * 1000000) + tv.tv_usec;
+}
+
+/* Pick a time between min and max msec, in usec. */
+static uint64_t
+pick_ms(unsigned long min, unsigned long max)
+{
+    unsigned long ms = min;
+
+    if (max > min) {
+	ms += (unsigned long)rand() % (max - min + 1);
+    }
+    return (uint64_t)ms * 1000;
+}
+
+/* Parse 'msec[,max-msec]'. Returns 0 for success, -1 for failure. */
+static int
+parse_range(const char *s, unsigned long *minp, unsigned long *maxp)
+{
+    char *ptr;
+
+    *minp = strtoul(s, &ptr, 10);
+    *maxp = *minp;
+    if (ptr == s) {
+	return -1;
+    }
+    if (*ptr == ',') {
+	s = ptr + 1;
+	*maxp = strtoul(s, &ptr, 10);
+	if (ptr == s) {
+	    return -1;
+	}
+    }
+    return (*ptr || *maxp < *minp)? -1: 0;
+}
+
+/* Parse a Think() line. Returns 0 if it is one. */
+static int
+parse_think(const char *line, unsigned long *minp, unsigned long *maxp)
+{
+    char buf[64];
+    size_t len;
+
+    if (strncasecmp(line, "Think(", 6)) {
+	return -1;
+    }
+    line += 6;
+    len = strlen(line);
+    if (len == 0 || len >= sizeof(buf) || line[len - 1] != ')') {
+	return -1;
+    }
+    memcpy(buf, line, len - 1);
+    buf[len - 1] = '\0';
+    return parse_range(buf, minp, maxp);
+}
+
+/* Read the script. */
+static void
+read_script(const char *path)
+{
+    FILE *f;
+    char line[1024];
+    size_t alloc = 0;
+
+    f = fopen(path, "r");
+    if (f == NULL) {
+	perror(path);
+	exit(1);
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+	char *s = line;
+	size_t len;
+	unsigned long a, b;
+
+	while (isspace((unsigned char)*s)) {
+	    s++;
+	}
+	len = strlen(s);
+	while (len && isspace((unsigned char)s[len - 1])) {
+	    s[--len] = '\0';
+	}
+	if (!len || *s == '#') {
+	    continue;
+	}
+	if (!strncasecmp(s, "Think(", 6) && parse_think(s, &a, &b) < 0) {
+	    fprintf(stderr, "%s: invalid line '%s'\n", me, s);
+	    exit(1);
+	}
+	if (n_script >= alloc) {
+	    alloc = alloc? alloc * 2: 32;
+	    script = realloc(script, alloc * sizeof(char *));
+	    if (script == NULL) {
+		perror("realloc");
+		exit(1);
+	    }
+	}
+	script[n_script] = malloc(len + 1);
+	if (script[n_script] == NULL) {
+	    perror("malloc");
+	    exit(1);
+	}
+	strcpy(script[n_script++], s);
+    }
+    fclose(f);
+    if (!n_script) {
+	fprintf(stderr, "%s: empty script\n", me);
+	exit(1);
+    }
+}
+
+/* Get the counts for the interval containing a time. */
+static interval_t *
+get_interval(uint64_t t)
+{
+    size_t ix = (size_t)((t - t_start) / ((uint64_t)interval * 1000000));
+
+    if (ix >= n_intervals) {
+	intervals = realloc(intervals, (ix + 1) * sizeof(interval_t));
+	if (intervals == NULL) {
+	    perror("realloc");
+	    exit(1);
+	}
+	memset(intervals + n_intervals, 0,
+		(ix + 1 - n_intervals) * sizeof(interval_t));
+	n_intervals = ix + 1;
+    }
+    return &intervals[ix];
+}
+
+/* Record an error. */
+static void
+count_error(term_t *t, int kind, const char *what)
+{
+    errors[kind]++;
+    get_interval(now_us())->errors++;
+    if (verbose) {
+	printf("%d: %s: %s\n", t->id, error_names[kind], what);
+    }
+}
+
+/* Record a transaction. */
+static void
+transaction(unsigned long usec)
+{
+    interval_t *iv = get_interval(now_us());
+
+    if (n_samples >= samples_alloc) {
+	samples_alloc = samples_alloc? samples_alloc * 2: 1024;
+	samples = realloc(samples, samples_alloc * sizeof(unsigned long));
+	if (samples == NULL) {
+	    perror("realloc");
+	    exit(1);
+	}
+    }
+    samples[n_samples++] = usec;
+    iv->txns++;
+    iv->usec += usec;
+}
+
+/* Start a terminal. */
+static void
+term_start(term_t *t, char **eargv)
+{
+    int to[2], from[2];
+
+    if (pipe(to) < 0 || pipe(from) < 0) {
+	perror("pipe");
+	exit(1);
+    }
+    switch (t->pid = fork()) {
+    case -1:
+	perror("fork");
+	exit(1);
+    case 0:
+	dup2(to[0], 0);
+	dup2(from[1], 1);
+	close(to[0]);
+	close(to[1]);
+	close(from[0]);
+	close(from[1]);
+	execvp(eargv[0], eargv);
+	perror(eargv[0]);
+	_exit(1);
+    default:
+	break;
+    }
+    close(to[0]);
+    close(from[1]);
+    t->to = to[1];
+    t->from = from[0];
+    fcntl(t->to, F_SETFD, FD_CLOEXEC);
+    fcntl(t->from, F_SETFD, FD_CLOEXEC);
+    t->state = T_THINKING;
+    t->wake = 0;
+}
+
+/* Send a line to a terminal. */
+static void
+term_send(term_t *t, const char *s)
+{
+    size_t len = strlen(s);
+
+    while (len) {
+	ssize_t nw = write(t->to, s, len);
+
+	if (nw < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    break;
+	}
+	s += nw;
+	len -= nw;
+    }
+}
+
+/* The terminal is gone. */
+static void
+term_done(term_t *t)
+{
+    if (t->state == T_DONE) {
+	return;
+    }
+    close(t->to);
+    close(t->from);
+    t->state = T_DONE;
+}
+
+/* Run the next script line, or finish. */
+static void
+term_next(term_t *t, uint64_t now)
+{
+    while (t->state == T_THINKING) {
+	unsigned long a, b;
+	char *line;
+
+	if (t->line >= n_script) {
+	    t->line = 0;
+	    if (!duration || stop) {
+		term_send(t, "Quit()\n");
+		t->state = T_QUITTING;
+		t->sent = now;
+		return;
+	    }
+	}
+	if (stop) {
+	    t->line = n_script;
+	    continue;
+	}
+	line = script[t->line++];
+	if (parse_think(line, &a, &b) == 0) {
+	    t->wake = now + pick_ms(a, b);
+	    return;
+	}
+	term_send(t, line);
+	if (line[strlen(line) - 1] != ')') {
+	    /* Keep the query from being taken as an argument. */
+	    term_send(t, "()");
+	}
+	term_send(t, " Query(ResponseTime)\n");
+	t->data[0] = '\0';
+	t->sent = now;
+	t->state = T_RUNNING;
+    }
+}
+
+/* Process a complete line of output from a terminal. */
+static void
+term_line(term_t *t, char *s, uint64_t now)
+{
+    if (!strncmp(s, "data:", 5)) {
+	s += 5;
+	if (*s == ' ') {
+	    s++;
+	}
+	strncpy(t->data, s, sizeof(t->data) - 1);
+	t->data[sizeof(t->data) - 1] = '\0';
+	return;
+    }
+
+    if (strcmp(s, "ok") && strcmp(s, "error")) {
+	/* Prompt. */
+	return;
+    }
+    if (t->state == T_QUITTING) {
+	return;
+    }
+
+    if (!strcmp(s, "ok")) {
+	unsigned long count, secs, usecs;
+
+	if (sscanf(t->data, "%lu %lu.%lu", &count, &secs, &usecs) == 3 &&
+		count != t->txn_count) {
+	    t->txn_count = count;
+	    transaction((secs * 1000000) + usecs);
+	    t->state = T_THINKING;
+	    t->wake = now + pick_ms(think_min, think_max);
+	    return;
+	}
+    } else {
+	count_error(t, E_ACTION, t->data[0]? t->data: script[t->line - 1]);
+    }
+    t->state = T_THINKING;
+    t->wake = now;
+}
+
+/* Read from a terminal. */
+static void
+term_read(term_t *t, uint64_t now)
+{
+    ssize_t nr;
+    size_t i, start = 0;
+
+    nr = read(t->from, t->rbuf + t->rlen, sizeof(t->rbuf) - t->rlen);
+    if (nr <= 0) {
+	if (nr < 0 && errno == EINTR) {
+	    return;
+	}
+	if (t->state != T_QUITTING) {
+	    count_error(t, E_EXIT, "emulator exited");
+	}
+	term_done(t);
+	return;
+    }
+    t->rlen += nr;
+    for (i = 0; i < t->rlen; i++) {
+	if (t->rbuf[i] == '\n') {
+	    t->rbuf[i] = '\0';
+	    term_line(t, t->rbuf + start, now);
+	    start = i + 1;
+	}
+    }
+    if (start == 0 && t->rlen == sizeof(t->rbuf)) {
+	/* Overlong line; drop it. */
+	t->rlen = 0;
+    } else {
+	memmove(t->rbuf, t->rbuf + start, t->rlen - start);
+	t->rlen -= start;
+    }
+}
+
+/* Compare response times. */
+static int
+cmp_ul(const void *a, const void *b)
+{
+    unsigned long ua = *(const unsigned long *)a;
+    unsigned long ub = *(const unsigned long *)b;
+
+    return (ua > ub) - (ua < ub);
+}
+
+/* Format a time in usec. */
+static const char *
+fmt_us(unsigned long us)
+{
+    static char buf[8][32];
+    static int ix = 0;
+    char *b = buf[ix++ % 8];
+
+    if (us < 1000000) {
+	sprintf(b, "%lu.%03lums", us / 1000, us % 1000);
+    } else {
+	sprintf(b, "%lu.%03lus", us / 1000000, (us / 1000) % 1000);
+    }
+    return b;
+}
+
+/* Draw a histogram bar. */
+static void
+bar(unsigned long n, unsigned long max)
+{
+    unsigned long len = max? (n * HIST_WIDTH + max - 1) / max: 0;
+
+    while (len--) {
+	putchar('#');
+    }
+    putchar('\n');
+}
+
+/* Print the results. */
+static void
+report(uint64_t elapsed)
+{
+    unsigned long counts[N_BUCKETS + 1];
+    unsigned long max = 0;
+    unsigned long total_errors = 0;
+    uint64_t sum = 0;
+    size_t i, j;
+
+    printf("\n%d terminals, %lu transactions in %lu.%03lus, "
+	    "%.1f transactions/s\n",
+	    n_terms, (unsigned long)n_samples,
+	    (unsigned long)(elapsed / 1000000),
+	    (unsigned long)((elapsed / 1000) % 1000),
+	    elapsed? (double)n_samples * 1000000.0 / (double)elapsed: 0.0);
+
+    /* Response times. */
+    if (n_samples) {
+	qsort(samples, n_samples, sizeof(unsigned long), cmp_ul);
+	memset(counts, 0, sizeof(counts));
+	for (i = 0; i < n_samples; i++) {
+	    for (j = 0; j < N_BUCKETS && samples[i] >= buckets[j]; j++) {
+	    }
+	    counts[j]++;
+	    sum += samples[i];
+	}
+	for (j = 0; j <= N_BUCKETS; j++) {
+	    if (counts[j] > max) {
+		max = counts[j];
+	    }
+	}
+	printf("\nResponse time (AID to keyboard unlock):\n");
+	printf("  min %s  mean %s  50%% %s  90%% %s  99%% %s  max %s\n",
+		fmt_us(samples[0]),
+		fmt_us((unsigned long)(sum / n_samples)),
+		fmt_us(samples[n_samples / 2]),
+		fmt_us(samples[(n_samples * 9) / 10]),
+		fmt_us(samples[(n_samples * 99) / 100]),
+		fmt_us(samples[n_samples - 1]));
+	for (j = 0; j <= N_BUCKETS; j++) {
+	    char label[32];
+
+	    if (j == N_BUCKETS) {
+		sprintf(label, ">= %s", fmt_us(buckets[j - 1]));
+	    } else {
+		sprintf(label, "< %s", fmt_us(buckets[j]));
+	    }
+	    printf("  %11s %8lu ", label, counts[j]);
+	    bar(counts[j], max);
+	}
+    }
+
+    /* Throughput and errors. */
+    max = 0;
+    for (i = 0; i < n_intervals; i++) {
+	if (intervals[i].txns > max) {
+	    max = intervals[i].txns;
+	}
+    }
+    printf("\nThroughput (per %lus):\n", interval);
+    printf("  %7s %8s %6s %10s\n", "time", "txns", "errors", "mean");
+    for (i = 0; i < n_intervals; i++) {
+	interval_t *iv = &intervals[i];
+
+	printf("  %6lus %8lu %6lu %10s ", (unsigned long)(i * interval),
+		iv->txns, iv->errors,
+		iv->txns? fmt_us((unsigned long)(iv->usec / iv->txns)): "-");
+	bar(iv->txns, max);
+    }
+
+    for (i = 0; i < E_NUM; i++) {
+	total_errors += errors[i];
+    }
+    printf("\nErrors: %lu", total_errors);
+    if (total_errors) {
+	const char *sep = " (";
+
+	for (i = 0; i < E_NUM; i++) {
+	    if (errors[i]) {
+		printf("%s%lu %s", sep, errors[i], error_names[i]);
+		sep = ", ";
+	    }
+	}
+	printf(")");
+    }
+    printf("\n");
+}
+
+static void
+catch_stop(int sig)
+{
+    stop = 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int c;
+    char *ptr;
+    term_t *terms;
+    char **eargv;
+    struct pollfd *pfds;
+    int *pterm;
+    int i;
+    int live;
+    uint64_t deadline = 0;
+
+    /* Parse command-line arguments */
+    if ((me = strrchr(argv[0], '/')) != NULL) {
+	me++;
+    } else {
+	me = argv[0];
+    }
+
+    while ((c = getopt(argc, argv, "d:e:i:n:r:t:vw:")) != -1) {
+	switch (c) {
+	case 'd':
+	    duration = strtoul(optarg, &ptr, 10);
+	    if (ptr == optarg || *ptr) {
+		usage();
+	    }
+	    break;
+	case 'e':
+	    emulator = optarg;
+	    break;
+	case 'i':
+	    interval = strtoul(optarg, &ptr, 10);
+	    if (ptr == optarg || *ptr || !interval) {
+		usage();
+	    }
+	    break;
+	case 'n':
+	    n_terms = atoi(optarg);
+	    if (n_terms <= 0) {
+		usage();
+	    }
+	    break;
+	case 'r':
+	    ramp = strtoul(optarg, &ptr, 10);
+	    if (ptr == optarg || *ptr) {
+		usage();
+	    }
+	    break;
+	case 't':
+	    if (parse_range(optarg, &think_min, &think_max) < 0) {
+		usage();
+	    }
+	    break;
+	case 'v':
+	    verbose = 1;
+	    break;
+	case 'w':
+	    timeout = strtoul(optarg, &ptr, 10);
+	    if (ptr == optarg || *ptr || !timeout) {
+		usage();
+	    }
+	    break;
+	default:
+	    usage();
+	}
+    }
+    if (argc - optind < 2) {
+	usage();
+    }
+    read_script(argv[optind++]);
+
+    /* Build the emulator command line. */
+    eargv = malloc((argc - optind + 2) * sizeof(char *));
+    if (eargv == NULL) {
+	perror("malloc");
+	exit(1);
+    }
+    eargv[0] = emulator;
+    for (i = 0; optind + i < argc; i++) {
+	eargv[i + 1] = argv[optind + i];
+    }
+    eargv[i + 1] = NULL;
+
+    terms = calloc(n_terms, sizeof(term_t));
+    pfds = calloc(n_terms, sizeof(struct pollfd));
+    pterm = calloc(n_terms, sizeof(int));
+    if (terms == NULL || pfds == NULL || pterm == NULL) {
+	perror("calloc");
+	exit(1);
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, catch_stop);
+    signal(SIGTERM, catch_stop);
+
+    t_start = now_us();
+    if (duration) {
+	deadline = t_start + ((uint64_t)duration * 1000000);
+    }
+    for (i = 0; i < n_terms; i++) {
+	terms[i].id = i + 1;
+	terms[i].state = T_WAITING;
+	terms[i].wake = t_start + ((uint64_t)ramp * 1000 * i);
+    }
+
+    /* Run. */
+    do {
+	uint64_t now = now_us();
+	int64_t delay = -1;
+	int np = 0;
+	int ns;
+
+	if (deadline && now >= deadline) {
+	    stop = 1;
+	}
+
+	/* Start terminals, run script lines and time out actions. */
+	live = 0;
+	for (i = 0; i < n_terms; i++) {
+	    term_t *t = &terms[i];
+	    uint64_t when = 0;
+
+	    if (t->state == T_WAITING) {
+		if (stop) {
+		    t->state = T_DONE;
+		    continue;
+		}
+		if (now >= t->wake) {
+		    term_start(t, eargv);
+		}
+	    }
+	    if (t->state == T_THINKING && (stop || now >= t->wake)) {
+		term_next(t, now);
+	    }
+	    if ((t->state == T_RUNNING || t->state == T_QUITTING) &&
+		    now - t->sent >= (uint64_t)timeout * 1000000) {
+		if (t->state == T_RUNNING) {
+		    count_error(t, E_TIMEOUT, script[t->line - 1]);
+		}
+		kill(t->pid, SIGKILL);
+		term_done(t);
+	    }
+
+	    switch (t->state) {
+	    case T_WAITING:
+	    case T_THINKING:
+		when = t->wake;
+		break;
+	    case T_RUNNING:
+	    case T_QUITTING:
+		when = t->sent + ((uint64_t)timeout * 1000000);
+		pfds[np].fd = t->from;
+		pfds[np].events = POLLIN;
+		pfds[np].revents = 0;
+		pterm[np++] = i;
+		break;
+	    case T_DONE:
+		continue;
+	    }
+	    live++;
+	    if (delay < 0 || when < now + (uint64_t)delay) {
+		delay = (when > now)? (int64_t)(when - now): 0;
+	    }
+	}
+	if (!live) {
+	    break;
+	}
+	if (deadline && !stop &&
+		(delay < 0 || deadline < now + (uint64_t)delay)) {
+	    delay = deadline - now;
+	}
+
+	ns = poll(pfds, np, (delay < 0)? -1: (int)((delay + 999) / 1000));
+	if (ns < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    perror("poll");
+	    exit(1);
+	}
+	now = now_us();
+	for (i = 0; i < np; i++) {
+	    if (pfds[i].revents) {
+		term_read(&terms[pterm[i]], now);
+	    }
+	}
+	if (verbose) {
+	    fflush(stdout);
+	}
+    } while (live);
+
+    /* Reap the emulators. */
+    while (wait(NULL) > 0 || errno == EINTR) {
+    }
+
+    report(now_us() - t_start);
+    return 0;
+}
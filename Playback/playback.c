@@ -46,6 +46,9 @@
 #include <arpa/inet.h>
 #include <arpa/telnet.h>
 #include <sys/select.h>
+#include <stdint.h>
+
+#include "bintrace.h"
 
 #define PORT		4001
 #define BSIZE		16384
@@ -62,6 +65,11 @@ static enum {
 } tstate = T_NONE;
 int fdisp = 0;
 
+/* Binary trace file state. */
+static int binary = 0;		/* file is a binary trace */
+static btrace_t bt;		/* binary trace reader */
+static size_t bt_pos = 0;	/* data sent from the current record */
+
 static void process(FILE *f, int s);
 typedef enum {
     STEP_LINE,	/* step one line in the file */
@@ -69,6 +77,7 @@ typedef enum {
     STEP_MARK	/* step until a mark (line starting with '+') */
 } step_t;
 static int step(FILE *f, int s, step_t type);
+static int bstep(int s, step_t type);
 static int process_command(FILE *f, int s);
 
 void
@@ -124,11 +133,12 @@ main(int argc, char *argv[])
     }
 
     /* Open the file. */
-    f = fopen(argv[optind], "r");
+    f = fopen(argv[optind], "rb");
     if (f == NULL) {
 	perror(argv[optind]);
 	exit(1);
     }
+    binary = bt_open(&bt, f);
 
     /* Listen on a socket. */
     s = socket(proto, SOCK_STREAM, 0);
@@ -217,7 +227,13 @@ main(int argc, char *argv[])
 		ntohs(addr.sin.sin_port)
 #endif /*]*/
 	);
-	rewind(f);
+	if (binary) {
+	    bt_rewind(&bt);
+	    bt.len = 0;
+	    bt_pos = 0;
+	} else {
+	    rewind(f);
+	}
 	pstate = BASE;
 	fdisp = 0;
 	process(f, s2);
@@ -402,6 +418,10 @@ step(FILE *f, int s, step_t type)
     int stop_eor = 0;
 #   define NO_FDISP { if (fdisp) { printf("\n"); fdisp = 0; } }
 
+    if (binary) {
+	return bstep(s, type);
+    }
+
 top:
     while (again || ((c = fgetc(f)) != EOF)) {
 	if (c == '\r') {
@@ -572,3 +592,81 @@ done:
 
     return 0;
 }
+
+/*
+ * Step through a binary trace file.
+ *
+ * Host data records are sent the same way the hex dump lines of a text trace
+ * are: a line at a time is LINEDUMP_MAX bytes.
+ *
+ * Returns 0 for EOF, nonzero otherwise.
+ */
+static int
+bstep(int s, step_t type)
+{
+    if (type == STEP_MARK) {
+	printf("Binary trace files have no marks.\n");
+	return 1;
+    }
+
+    for (;;) {
+	unsigned char *data;
+	size_t n;
+	size_t i;
+	int stop = 0;
+
+	/* Find the next record of host data. */
+	while (bt_pos >= bt.len) {
+	    int rv = bt_read(&bt);
+
+	    if (rv <= 0) {
+		printf("\n%s.\n", rv? "Malformed playback file":
+			"Playback file EOF");
+		bt.len = 0;
+		bt_pos = 0;
+		return 0;
+	    }
+	    if (bt.type != BT_NET_IN) {
+		bt.len = 0;
+		continue;
+	    }
+	    bt_pos = 0;
+	    printf("\nfile record %lu, %lu bytes\n", (unsigned long)bt.record,
+		    (unsigned long)bt.len);
+	}
+
+	/* Decide how much to send. */
+	data = bt.data + bt_pos;
+	n = bt.len - bt_pos;
+	if (type == STEP_LINE) {
+	    size_t line = LINEDUMP_MAX - (bt_pos % LINEDUMP_MAX);
+
+	    if (n > line) {
+		n = line;
+	    }
+	    stop = 1;
+	}
+	for (i = 0; i < n; i++) {
+	    if (tstate == T_IAC) {
+		tstate = T_NONE;
+		if (data[i] == EOR && type == STEP_EOR) {
+		    n = i + 1;
+		    stop = 1;
+		    break;
+		}
+	    } else if (data[i] == IAC) {
+		tstate = T_IAC;
+	    }
+	}
+
+	trace_netdata("host", data, (int)n);
+	if (write(s, data, n) < 0) {
+	    perror("socket write");
+	    return 0;
+	}
+	bt_pos += n;
+	if (stop) {
+	    return 1;
+	}
+    }
+}
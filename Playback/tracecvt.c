@@ -0,0 +1,536 @@
+/*
+ * Copyright (c) 2020 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Paul Mattes nor his contributors may be used
+ *       to endorse or promote products derived from this software without
+ *       specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Trace file converter for x3270.
+ *
+ * Converts binary trace files to text, optionally starting at a given record
+ * number or time, and text trace files to binary.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdint.h>
+
+#include "bintrace.h"
+
+#define LINEDUMP_MAX	32
+
+char *me;
+
+/* Binary trace writer state. */
+typedef struct {
+    FILE *f;
+    uint64_t offset;		/* current file offset */
+    uint64_t last_time;		/* time of the last record */
+    uint64_t records;		/* text and data records written */
+    uint64_t index_offset;	/* offset of the last index */
+    uint64_t block_record;	/* first record since the last index */
+    uint64_t block_time;	/*  its time */
+    uint64_t block_offset;	/*  its offset */
+} bwriter_t;
+
+void
+usage(void)
+{
+    fprintf(stderr, "\
+usage: %s [-r record] [-t yyyymmdd.hhmmss] [-n count] binary-file [text-file]\n\
+       %s -b text-file binary-file\n", me, me);
+    exit(1);
+}
+
+/* Convert 'n' decimal digits. */
+static int
+digits(const char *s, int n)
+{
+    int v = 0;
+
+    while (n--) {
+	v = (v * 10) + (*s++ - '0');
+    }
+    return v;
+}
+
+/*
+ * Convert a text trace timestamp (yyyymmdd.hhmmss, plus .mmm and a space if
+ * with_ms is set) to microseconds since the epoch.
+ */
+static int
+parse_ts(const char *s, int with_ms, uint64_t *tp)
+{
+    struct tm tm;
+    int i;
+    int ms = 0;
+
+    for (i = 0; i < 15; i++) {
+	if (i == 8) {
+	    if (s[i] != '.') {
+		return -1;
+	    }
+	} else if (!isdigit((unsigned char)s[i])) {
+	    return -1;
+	}
+    }
+    if (with_ms) {
+	if (s[15] != '.' ||
+		!isdigit((unsigned char)s[16]) ||
+		!isdigit((unsigned char)s[17]) ||
+		!isdigit((unsigned char)s[18]) ||
+		s[19] != ' ') {
+	    return -1;
+	}
+	ms = digits(s + 16, 3);
+    }
+
+    memset(&tm, 0, sizeof(tm));
+    tm.tm_year = digits(s, 4) - 1900;
+    tm.tm_mon = digits(s + 4, 2) - 1;
+    tm.tm_mday = digits(s + 6, 2);
+    tm.tm_hour = digits(s + 9, 2);
+    tm.tm_min = digits(s + 11, 2);
+    tm.tm_sec = digits(s + 13, 2);
+    tm.tm_isdst = -1;
+
+    *tp = ((uint64_t)mktime(&tm) * 1000000) + (ms * 1000);
+    return 0;
+}
+
+/* Write one record as text, the way trace.c would have. */
+static void
+record_to_text(btrace_t *b, FILE *out, int *wrote_ts)
+{
+    size_t i;
+
+    switch (b->type) {
+    case BT_TEXT:
+    case BT_TEXT_TS:
+	for (i = 0; i < b->len; i++) {
+	    if (b->type == BT_TEXT_TS && !*wrote_ts) {
+		fputs(bt_timestamp(b), out);
+		*wrote_ts = 1;
+	    }
+	    fputc(b->data[i], out);
+	    if (b->data[i] == '\n') {
+		*wrote_ts = 0;
+	    }
+	}
+	break;
+    case BT_NET_IN:
+    case BT_NET_OUT:
+	for (i = 0; i < b->len; i++) {
+	    if (!(i % LINEDUMP_MAX)) {
+		fprintf(out, "%s%c 0x%-3x ", i? "\n": "",
+			(b->type == BT_NET_IN)? '<': '>', (unsigned)i);
+	    }
+	    fprintf(out, "%02x", b->data[i]);
+	}
+	fputc('\n', out);
+	*wrote_ts = 0;
+	break;
+    default:
+	break;
+    }
+}
+
+/* Convert a binary trace to text. */
+static int
+to_text(btrace_t *b, FILE *out, uint64_t record, const char *when,
+	uint64_t count)
+{
+    uint64_t time = 0;
+    int wrote_ts = 0;
+    int rv;
+
+    if (when != NULL) {
+	uint64_t t;
+
+	if (parse_ts(when, 0, &t) < 0) {
+	    fprintf(stderr, "%s: invalid time '%s'\n", me, when);
+	    return 1;
+	}
+	if (t > b->start) {
+	    time = t - b->start;
+	}
+    }
+
+    rv = bt_seek(b, record, time);
+    while (rv > 0 && count) {
+	if ((rv = bt_read(b)) <= 0) {
+	    break;
+	}
+	if (b->type == BT_INDEX || b->type == BT_TRAILER) {
+	    continue;
+	}
+	record_to_text(b, out, &wrote_ts);
+	count--;
+    }
+    if (rv < 0) {
+	fprintf(stderr, "%s: malformed trace file\n", me);
+	return 1;
+    }
+    return 0;
+}
+
+/* Write bytes to a binary trace. */
+static void
+bw_write(bwriter_t *w, const void *buf, size_t len)
+{
+    if (len && fwrite(buf, len, 1, w->f) != 1) {
+	perror("write");
+	exit(1);
+    }
+    w->offset += len;
+}
+
+/* Write a varint to a binary trace. */
+static void
+bw_varint(bwriter_t *w, uint64_t v)
+{
+    unsigned char buf[VARINT_MAX];
+
+    bw_write(w, buf, varint_put(buf, v) - buf);
+}
+
+/* Write a record to a binary trace. */
+static void
+bw_record(bwriter_t *w, int type, uint64_t time, const void *data,
+	size_t len)
+{
+    unsigned char t = type;
+
+    if (time < w->last_time) {
+	time = w->last_time;
+    }
+    if (type != BT_INDEX && type != BT_TRAILER &&
+	    w->records == w->block_record) {
+	w->block_time = time;
+	w->block_offset = w->offset;
+    }
+    bw_write(w, &t, 1);
+    bw_varint(w, len);
+    bw_varint(w, time - w->last_time);
+    bw_write(w, data, len);
+    w->last_time = time;
+}
+
+/* Write an index record to a binary trace. */
+static void
+bw_index(bwriter_t *w)
+{
+    unsigned char buf[BT_INDEX_LEN];
+    unsigned char *p = buf;
+    uint64_t offset = w->offset;
+
+    if (w->records == w->block_record) {
+	return;
+    }
+    p = bt_put64(p, w->index_offset);
+    p = bt_put64(p, w->block_record);
+    p = bt_put64(p, w->block_time);
+    bt_put64(p, w->block_offset);
+    bw_record(w, BT_INDEX, w->last_time, buf, sizeof(buf));
+    w->index_offset = offset;
+    w->block_record = w->records;
+}
+
+/* Write a text or data record to a binary trace. */
+static void
+bw_data_record(bwriter_t *w, int type, uint64_t time, const void *data,
+	size_t len)
+{
+    bw_record(w, type, time, data, len);
+    if (++w->records - w->block_record >= BT_INDEX_INTERVAL) {
+	bw_index(w);
+    }
+}
+
+/* Read a line of any length. Returns its length, or 0 for EOF. */
+static size_t
+read_line(FILE *f, char **bufp, size_t *allocp)
+{
+    size_t len = 0;
+    int c;
+
+    while ((c = fgetc(f)) != EOF) {
+	if (len + 2 > *allocp) {
+	    *allocp = *allocp? *allocp * 2: 256;
+	    *bufp = realloc(*bufp, *allocp);
+	    if (*bufp == NULL) {
+		perror("realloc");
+		exit(1);
+	    }
+	}
+	(*bufp)[len++] = c;
+	if (c == '\n') {
+	    break;
+	}
+    }
+    if (len) {
+	(*bufp)[len] = '\0';
+    }
+    return len;
+}
+
+/*
+ * Parse a hex dump line written by trace_netdata().
+ * Returns the number of bytes, or 0 if it is not one. The line must be
+ * exactly what trace_netdata() would produce, so the conversion is lossless.
+ */
+static size_t
+parse_netdata(const char *line, size_t len, char *dirp, unsigned *offsetp,
+	unsigned char *data)
+{
+    static const char hexes[] = "0123456789abcdef";
+    char hdr[32];
+    unsigned offset;
+    const char *s;
+    size_t n = 0;
+    int hl;
+
+    if (len < 8 || (line[0] != '<' && line[0] != '>') ||
+	    strncmp(line + 1, " 0x", 3) || line[len - 1] != '\n') {
+	return 0;
+    }
+    offset = (unsigned)strtoul(line + 4, NULL, 16);
+    hl = sprintf(hdr, "%c 0x%-3x ", line[0], offset);
+    if ((size_t)hl >= len || strncmp(line, hdr, hl)) {
+	return 0;
+    }
+    for (s = line + hl; *s != '\n'; s += 2) {
+	const char *h1 = strchr(hexes, s[0]);
+	const char *h2;
+
+	if (!s[0] || h1 == NULL || !s[1] ||
+		(h2 = strchr(hexes, s[1])) == NULL ||
+		n >= LINEDUMP_MAX) {
+	    return 0;
+	}
+	data[n++] = ((h1 - hexes) << 4) | (h2 - hexes);
+    }
+    *dirp = line[0];
+    *offsetp = offset;
+    return n;
+}
+
+/* Convert a text trace to binary. */
+static int
+to_binary(FILE *in, FILE *out)
+{
+    bwriter_t w;
+    char *line = NULL;
+    size_t alloc = 0;
+    size_t len;
+    unsigned char hdr[BT_HEADER_SIZE];
+    uint64_t start = 0;
+    uint64_t time = 0;
+    unsigned char *net = NULL;
+    size_t net_len = 0;
+    size_t net_alloc = 0;
+    char net_dir = 0;
+    unsigned char trailer[BT_TRAILER_SIZE];
+    unsigned char *p;
+
+    /* Use the first timestamp as the start time. */
+    while ((len = read_line(in, &line, &alloc)) > 0) {
+	if (len >= 20 && parse_ts(line, 1, &start) == 0) {
+	    break;
+	}
+    }
+    rewind(in);
+
+    memset(&w, 0, sizeof(w));
+    w.f = out;
+    memcpy(hdr, BT_MAGIC, BT_MAGIC_LEN);
+    hdr[BT_MAGIC_LEN] = BT_VERSION;
+    bt_put64(hdr + BT_MAGIC_LEN + 1, start);
+    bw_write(&w, hdr, sizeof(hdr));
+
+    while ((len = read_line(in, &line, &alloc)) > 0) {
+	unsigned char data[LINEDUMP_MAX];
+	char dir;
+	unsigned offset;
+	size_t n;
+	uint64_t t;
+
+	/* Hex dumps of network data. */
+	n = parse_netdata(line, len, &dir, &offset, data);
+	if (n > 0 && offset == net_len && dir == net_dir &&
+		net_len > 0 && !(net_len % LINEDUMP_MAX)) {
+	    /* Continuation. */
+	} else if (n > 0 && offset == 0) {
+	    /* New record. */
+	    if (net_len) {
+		bw_data_record(&w, (net_dir == '<')? BT_NET_IN: BT_NET_OUT,
+			time, net, net_len);
+	    }
+	    net_len = 0;
+	    net_dir = dir;
+	} else {
+	    n = 0;
+	}
+	if (n > 0) {
+	    if (net_len + n > net_alloc) {
+		net_alloc = net_alloc? net_alloc * 2: 4096;
+		net = realloc(net, net_alloc);
+		if (net == NULL) {
+		    perror("realloc");
+		    exit(1);
+		}
+	    }
+	    memcpy(net + net_len, data, n);
+	    net_len += n;
+	    continue;
+	}
+	if (net_len) {
+	    bw_data_record(&w, (net_dir == '<')? BT_NET_IN: BT_NET_OUT, time,
+		    net, net_len);
+	    net_len = 0;
+	}
+
+	/* Text, with or without a timestamp. */
+	if (len >= 20 && parse_ts(line, 1, &t) == 0) {
+	    time = (t > start)? t - start: 0;
+	    bw_data_record(&w, BT_TEXT_TS, time, line + 20, len - 20);
+	} else {
+	    bw_data_record(&w, BT_TEXT, time, line, len);
+	}
+    }
+    if (net_len) {
+	bw_data_record(&w, (net_dir == '<')? BT_NET_IN: BT_NET_OUT, time,
+		net, net_len);
+    }
+
+    /* Finish with an index and the trailer. */
+    bw_index(&w);
+    p = trailer;
+    *p++ = BT_TRAILER;
+    *p++ = BT_TRAILER_LEN;
+    *p++ = 0;
+    p = bt_put64(p, w.index_offset);
+    memcpy(p, BT_TRAILER_MAGIC, BT_MAGIC_LEN);
+    bw_write(&w, trailer, sizeof(trailer));
+
+    free(line);
+    free(net);
+    if (fflush(out) != 0) {
+	perror("write");
+	return 1;
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int c;
+    int binary = 0;
+    uint64_t record = 0;
+    uint64_t count = (uint64_t)-1;
+    char *when = NULL;
+    FILE *in, *out;
+    btrace_t b;
+    int rv;
+
+    if ((me = strrchr(argv[0], '/')) != NULL) {
+	me++;
+    } else {
+	me = argv[0];
+    }
+
+    while ((c = getopt(argc, argv, "bn:r:t:")) != -1) {
+	switch (c) {
+	case 'b':
+	    binary = 1;
+	    break;
+	case 'n':
+	    count = strtoul(optarg, NULL, 0);
+	    break;
+	case 'r':
+	    record = strtoul(optarg, NULL, 0);
+	    break;
+	case 't':
+	    when = optarg;
+	    break;
+	default:
+	    usage();
+	}
+    }
+
+    if (binary) {
+	if (argc - optind != 2 || when != NULL) {
+	    usage();
+	}
+	if ((in = fopen(argv[optind], "r")) == NULL) {
+	    perror(argv[optind]);
+	    exit(1);
+	}
+	if ((out = fopen(argv[optind + 1], "wb")) == NULL) {
+	    perror(argv[optind + 1]);
+	    exit(1);
+	}
+	rv = to_binary(in, out);
+	fclose(in);
+	if (fclose(out) != 0) {
+	    perror(argv[optind + 1]);
+	    rv = 1;
+	}
+	return rv;
+    }
+
+    if (argc - optind < 1 || argc - optind > 2) {
+	usage();
+    }
+    if ((in = fopen(argv[optind], "rb")) == NULL) {
+	perror(argv[optind]);
+	exit(1);
+    }
+    if (!bt_open(&b, in)) {
+	fprintf(stderr, "%s: %s is not a binary trace file\n", me,
+		argv[optind]);
+	exit(1);
+    }
+    if (argc - optind == 2) {
+	if ((out = fopen(argv[optind + 1], "w")) == NULL) {
+	    perror(argv[optind + 1]);
+	    exit(1);
+	}
+    } else {
+	out = stdout;
+    }
+    rv = to_text(&b, out, record, when, count);
+    if (fflush(out) != 0) {
+	perror("write");
+	rv = 1;
+    }
+    return rv;
+}
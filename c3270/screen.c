@@ -296,6 +296,8 @@ static int screen_yoffset = 0;	/* Vertical offset to top of screen.
 
 static host_color_ix crosshair_color = HOST_COLOR_PURPLE;
 static bool curses_alt = false;
+static bool redraw_all = true;	/* Next screen_disp() redraws every row */
+static unsigned last_menu_is_up = 0;
 #if defined(HAVE_USE_DEFAULT_COLORS) /*[*/
 static bool default_colors = false;
 #endif /*]*/
@@ -796,6 +798,7 @@ swap_screens(SCREEN *new_screen)
 {
     set_term(new_screen);
     cur_screen = new_screen;
+    redraw_all = true;
 }
 #endif /*]*/
 
@@ -1279,6 +1282,9 @@ screen_disp(bool erasing _is_unused)
     enum dbcs_state d;
     int fa_addr;
     char mb[16];
+    bool all_rows;
+    bool skipped = false;
+    int first_row, last_row;
 
     /* This may be called when it isn't time. */
     if (escaped) {
@@ -1367,12 +1373,35 @@ screen_disp(bool erasing _is_unused)
 	}
     }
 
+    /*
+     * Redraw only the rows that have changed, unless a menu, the keypad or
+     * the crosshair cursor is (or was) in the way.
+     */
+    all_rows = redraw_all ||
+	menu_is_up ||
+	menu_is_up != last_menu_is_up ||
+	toggled(CROSSHAIR);
+    (void) ctlr_changed_rows(&first_row, &last_row);
+    redraw_all = false;
+    last_menu_is_up = menu_is_up;
+
     fa = get_field_attribute(0);
     fa_addr = find_field_attribute(0);
     field_attrs = calc_attrs(fa_addr, fa_addr, fa);
     for (row = 0; row < ROWS; row++) {
 	int baddr;
 
+	if (!all_rows && !ctlr_row_changed(row)) {
+	    skipped = true;
+	    continue;
+	}
+	if (skipped) {
+	    fa = get_field_attribute(row * cCOLS);
+	    fa_addr = find_field_attribute(row * cCOLS);
+	    field_attrs = calc_attrs(fa_addr, fa_addr, fa);
+	    skipped = false;
+	}
+
 	if (!flipped) {
 	    move(row + screen_yoffset, 0);
 	}
@@ -1578,6 +1607,7 @@ screen_disp(bool erasing _is_unused)
 	    }
 	}
     }
+    ctlr_changed_rows_reset();
     if (status_row) {
 	draw_oia();
     }
@@ -2050,12 +2080,14 @@ cursor_move(int baddr)
 static void
 toggle_monocase(toggle_index_t ix _is_unused, enum toggle_type tt _is_unused)
 {
+    redraw_all = true;
     screen_disp(false);
 }
 
 static void
 toggle_underscore(toggle_index_t ix _is_unused, enum toggle_type tt _is_unused)
 {
+    redraw_all = true;
     screen_disp(false);
 }
 
@@ -2063,6 +2095,7 @@ static void
 toggle_visibleControl(toggle_index_t ix _is_unused,
 	enum toggle_type tt _is_unused)
 {
+    redraw_all = true;
     screen_disp(false);
 }
 
@@ -2083,6 +2116,7 @@ toggle_showTiming(toggle_index_t ix _is_unused, enum toggle_type tt _is_unused)
 static void
 toggle_crosshair(toggle_index_t ix _is_unused, enum toggle_type tt _is_unused)
 {
+    redraw_all = true;
     screen_disp(false);
 }
 
@@ -2707,6 +2741,7 @@ void
 screen_flip(void)
 {
     flipped = !flipped;
+    redraw_all = true;
     screen_disp(false);
 }
 
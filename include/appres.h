@@ -59,8 +59,10 @@ typedef struct {
     bool	 new_environ;
     bool	 socket;
     bool	 trace_monitor;
+    bool	 trace_binary;
     bool	 script_port_once;
     bool	 bind_unlock;
+    bool	 use_select;
     char	*script_port;
     char	*httpd_port;
     char	*dbcs_cgcsgid;
@@ -200,6 +202,7 @@ typedef struct {
     /* scripting-specific fields. */
     struct {
 	char	*callback;
+	bool	 ui_binary;
     } scripting;
 
 } AppRes, *AppResptr;
@@ -198,3 +198,43 @@
 #define ValTrue		ResTrue
 #define ValFalse	ResFalse
 #define ValTrueFalse(b)	((b)? ValTrue: ValFalse)
+
+/*
+ * Binary output protocol (b3270 -uibinary).
+ *
+ * This carries exactly the same elements and attributes as the XML output,
+ * in a more compact form. Input is always XML.
+ *
+ * The output starts with BinMagic, followed by records. Each record is a
+ * one-byte type, the length of its payload, and the payload. Lengths and
+ * other numbers are unsigned LEB128 varints. Records of unknown types can be
+ * skipped using their lengths.
+ *
+ *  BinDefine	index, then the bytes of a name. Element and attribute names,
+ *		and short attribute values, are sent once, on first use, and
+ *		are referred to by index afterwards.
+ *  BinLeaf	element name index, attribute count, then for each attribute,
+ *		an attribute name index and a value.
+ *  BinPush	same as BinLeaf, but starts a container element.
+ *  BinPop	no payload, ends the innermost container element.
+ *
+ * A value is a one-byte type, followed by:
+ *  BinValString  a length and that many bytes of UTF-8
+ *  BinValUint	  a varint, for values that are decimal integers
+ *  BinValNint	  a varint, for values that are negative decimal integers
+ *  BinValName	  a name index, for short values that have been defined
+ */
+#define BinMagic	"B3270\001"
+#define BinMagicLen	6
+
+/* Record types. */
+#define BinDefine	0x01
+#define BinLeaf		0x02
+#define BinPush		0x03
+#define BinPop		0x04
+
+/* Value types. */
+#define BinValString	0x00
+#define BinValUint	0x01
+#define BinValNint	0x02
+#define BinValName	0x03
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2020 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *      bintrace.h
+ *              Binary trace file format, written by trace.c when the
+ *              traceBinary resource is set, and read by playback,
+ *              tracecvt, hostsim and bench3270. The functions are in
+ *              bintrace.c.
+ *
+ * A binary trace file starts with a header:
+ *   8 bytes:   BT_MAGIC
+ *   1 byte:    BT_VERSION
+ *   8 bytes:   wall-clock time the trace started, in microseconds since the
+ *              epoch, little-endian
+ *
+ * It is followed by records:
+ *   1 byte:    record type (BT_xxx)
+ *   varint:    payload length
+ *   varint:    microseconds since the previous record, from a monotonic
+ *              clock (the first record is relative to the start time)
+ *   payload
+ * Varints are LEB128: 7 bits per byte, least significant first, with the
+ * high bit set on all but the last byte.
+ *
+ * BT_TEXT and BT_TEXT_TS records are the output of one trace call, without
+ * timestamps. For BT_TEXT_TS, a text trace would have a timestamp at the
+ * start of each line.
+ *
+ * BT_NET_IN and BT_NET_OUT records are the raw bytes received from or sent
+ * to the host, which a text trace shows as hex dumps.
+ *
+ * Every BT_INDEX_INTERVAL records, a BT_INDEX record is written. Its payload
+ * is four little-endian 8-byte values: the offset of the previous BT_INDEX
+ * record (0 for none), and the record number (counting from 0, and counting
+ * only text and data records), time (microseconds since the start) and file
+ * offset of the first record after the previous index.
+ *
+ * When the trace file is closed, a BT_INDEX record is written for the records
+ * since the last one, followed by a BT_TRAILER record. Its payload is the
+ * 8-byte offset of that BT_INDEX record, followed by BT_TRAILER_MAGIC. A
+ * reader can find it by looking at the last BT_TRAILER_SIZE bytes of the
+ * file, and then walk the chain of index records backwards. Files without a
+ * trailer (for example, from a trace that is still active) can be read
+ * sequentially.
+ */
+
+#define BT_MAGIC		"x3270trc"
+#define BT_MAGIC_LEN		8
+#define BT_VERSION		1
+#define BT_HEADER_SIZE		(BT_MAGIC_LEN + 1 + 8)
+
+#define BT_TEXT			1	/* trace text */
+#define BT_TEXT_TS		2	/* trace text, timestamped lines */
+#define BT_NET_IN		3	/* data from the host */
+#define BT_NET_OUT		4	/* data to the host */
+#define BT_INDEX		5	/* index */
+#define BT_TRAILER		6	/* trailer */
+
+#define BT_INDEX_INTERVAL	1024	/* records between index records */
+#define BT_INDEX_LEN		32	/* length of an index payload */
+
+#define BT_TRAILER_MAGIC	"x3270end"
+#define BT_TRAILER_LEN		(8 + BT_MAGIC_LEN)	/* payload length */
+#define BT_TRAILER_SIZE		(3 + BT_TRAILER_LEN)	/* whole record */
+
+#define VARINT_MAX		10	/* longest varint, in bytes */
+
+uint64_t bt_get64(const unsigned char *p);
+unsigned char *bt_put64(unsigned char *p, uint64_t v);
+unsigned char *varint_put(unsigned char *p, uint64_t v);
+int varint_get(const unsigned char **pp, const unsigned char *end,
+	uint64_t *vp);
+
+/* Binary trace file reader. */
+typedef struct {
+    FILE *f;
+    uint64_t start;		/* wall-clock start time, usec since the epoch */
+    uint64_t time;		/* time of the current record, usec since start */
+    uint64_t next_record;	/* number of the next text or data record */
+    uint64_t record;		/* number of the current record */
+    long offset;		/* file offset of the current record */
+    int type;			/* type of the current record */
+    unsigned char *data;	/* payload of the current record */
+    size_t len;			/* length of the payload */
+    size_t alloc;		/* allocated length of data */
+    int pending;		/* current record is yet to be returned */
+    int rebase;			/* next record's time is 'time' */
+} btrace_t;
+
+int bt_open(btrace_t *b, FILE *f);
+void bt_rewind(btrace_t *b);
+int bt_read(btrace_t *b);
+int bt_seek(btrace_t *b, uint64_t record, uint64_t time);
+char *bt_timestamp(btrace_t *b);
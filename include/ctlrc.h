@@ -48,6 +48,8 @@ extern int last_changed;
 void ctlr_aclear(int baddr, int count, int clear_ea);
 void ctlr_add(int baddr, unsigned char c, unsigned char cs);
 void ctlr_add_nvt(int baddr, ucs4_t ucs4, unsigned char cs);
+void ctlr_add_run(int baddr, const unsigned char *c, const unsigned char *cs,
+	int count);
 void ctlr_add_bg(int baddr, unsigned char color);
 void ctlr_add_cs(int baddr, unsigned char cs);
 void ctlr_add_fa(int baddr, unsigned char fa, unsigned char cs);
@@ -57,6 +59,10 @@ void ctlr_altbuffer(bool alt);
 bool ctlr_any_data(void);
 void ctlr_bcopy(int baddr_from, int baddr_to, int count, int move_ea);
 void ctlr_changed(int bstart, int bend);
+unsigned long ctlr_change_serial(void);
+bool ctlr_changed_rows(int *first_row, int *last_row);
+void ctlr_changed_rows_reset(void);
+void ctlr_rows_moved(void);
 void ctlr_clear(bool can_snap);
 void ctlr_erase(bool alt);
 void ctlr_erase_all_unprotected(void);
@@ -68,10 +74,17 @@ const char *ctlr_query_cursor1(void);
 const char *ctlr_query_formatted(void);
 const char *ctlr_query_max_size(void);
 const char *ctlr_query_max_size_old(void);
+const char *ctlr_query_response_time(void);
+const char *ctlr_query_screen_generation(void);
 void ctlr_read_buffer(unsigned char aid_byte);
 void ctlr_read_modified(unsigned char aid_byte, bool all);
 void ctlr_reinit(unsigned cmask);
 void ctlr_reset(void);
+bool ctlr_row_changed(int row);
+bool ctlr_rows_changed_since(int first_row, int last_row,
+	unsigned long serial);
+unsigned long ctlr_screen_generation(void);
+uint64_t ctlr_screen_hash(void);
 void ctlr_scroll(unsigned char fg, unsigned char bg);
 void ctlr_shrink(void);
 void ctlr_snap_buffer(void);
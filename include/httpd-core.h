@@ -75,10 +75,14 @@ httpd_status_t httpd_input(void *dhandle, const char *data, size_t len);
 void httpd_close(void *dhandle, const char *why);
 
 /* Callable from methods. */
+typedef const char *httpd_etag_t(void);
 httpd_status_t httpd_dyn_complete(void *dhandle,
 	const char *format, ...);
 httpd_status_t httpd_dyn_error(void *dhandle, content_t content_type,
 	int status_code, const char *format, ...);
+void httpd_set_etag(void *dhandle, httpd_etag_t *etag);
+bool httpd_etag_matches(void *dhandle);
+httpd_status_t httpd_dyn_not_modified(void *dhandle);
 char *html_quote(const char *text);
 char *uri_quote(const char *text);
 const char *httpd_fetch_query(void *dhandle, const char *name);
@@ -150,6 +150,8 @@
 #define KwAssert	"assert"
 #define KwExit		"exit"
 #define KwNull		"null"
+/*  Parameters to Expect(). */
+#define KwOr		"or"
 /*  Parameters to HexString(). */
 #define KwDashAscii	"-ascii"
 /*  Parameters to KeyboardDisable(). */
@@ -193,7 +195,9 @@
 #define KwModel		"Model"
 #define KwPrefixes	"Prefixes"
 #define KwProxy		"Proxy"
+#define KwResponseTime	"ResponseTime"
 #define KwScreenCurSize	"ScreenCurSize"
+#define KwScreenGeneration "ScreenGeneration"
 #define KwScreenMaxSize	"ScreenMaxSize"
 #define KwScreenSizeCurrent "ScreenSizeCurrent"
 #define KwScreenSizeMax	"ScreenSizeMax"
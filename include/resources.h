@@ -220,15 +220,18 @@
 #define ResTermName		"termName"
 #define ResTitle		"title"
 #define ResTrace		"trace"
+#define ResTraceBinary		"traceBinary"
 #define ResTraceDir		"traceDir"
 #define ResTraceFile		"traceFile"
 #define ResTraceFileSize	"traceFileSize"
 #define ResTraceMonitor		"traceMonitor"
 #define ResTypeahead		"typeahead"
 #define ResUnderscore		"underscore"
+#define ResUiBinary		"uiBinary"
 #define ResUnlockDelay		"unlockDelay"
 #define ResUnlockDelayMs	"unlockDelayMs"
 #define ResUseCursorColor	"useCursorColor"
+#define ResUseSelect		"useSelect"
 #define ResUser			"user"
 #define ResUtf8			"utf8"
 #define ResVerifyHostCert	"verifyHostCert"
@@ -290,6 +293,7 @@
 #define DotTermName		"." ResTermName
 #define DotTitle		"." ResTitle
 #define DotTrace		"." ResTrace
+#define DotTraceBinary		"." ResTraceBinary
 #define DotTraceFile		"." ResTraceFile
 #define DotTraceFileSize	"." ResTraceFileSize
 #define DotUser			"." ResUser
@@ -446,6 +450,7 @@
 #define ClsSuppressFontMenu	"SuppressFontMenu"
 #define ClsTermName		"TermName"
 #define ClsTrace		"Trace"
+#define ClsTraceBinary		"TraceBinary"
 #define ClsTraceDir		"TraceDir"
 #define ClsTraceFile		"TraceFile"
 #define ClsTraceFileSize	"TraceFileSize"
@@ -490,6 +495,7 @@
 #define OptDefScreen		"-defscreen"
 #define OptDevName		"-devname"
 #define OptTrace		"-trace"
+#define OptUiBinary		"-uibinary"
 #define OptEmulatorFont		"-efont"
 #define OptHostsFile		"-hostsfile"
 #define OptHelp1		"--help"
@@ -536,6 +542,7 @@
 #define OptNoVerifyHostCert	"-noverifycert"
 #define OptTermName		"-tn"
 #define OptTitle		"-title"
+#define OptTraceBinary		"-tracebinary"
 #define OptTraceFile		"-tracefile"
 #define OptTraceFileSize	"-tracefilesize"
 #define OptUser			"-user"
@@ -42,6 +42,7 @@ void mcursor_normal(void);
 void mcursor_waiting(void);
 bool screen_obscured(void);
 void screen_scroll(unsigned char fg, unsigned char bg);
+bool screen_scroll_needs_sync(void);
 unsigned long screen_window_number(void);
 bool screen_has_bg_color(void);
 void ring_bell(void);
@@ -69,6 +69,7 @@ void task_abort_input_request_irhandle(void *irhandle);
 void task_abort_input_request(void);
 bool task_is_interactive(void);
 bool task_nonblocking_connect(void);
+char *task_status_string(void);
 
 /* Input request vectors. */
 typedef void (*ir_state_abort_cb)(void *state);
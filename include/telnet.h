@@ -44,6 +44,7 @@ extern int ns_rsent;
 extern time_t ns_time;
 extern const char *state_name[];
 extern struct timeval net_last_recv_ts;
+extern bool net_bulk_input;
 
 void net_abort(void);
 void net_break(char c);
@@ -53,6 +54,7 @@ void net_exception(iosrc_t fd, ioid_t id);
 int net_getsockname(void *buf, int *len);
 void net_hexnvt_out(unsigned char *buf, int len);
 void net_input(iosrc_t fd, ioid_t id);
+bool net_process_input(unsigned char *buf, size_t nr);
 void net_interrupt(char c);
 void net_linemode(void);
 void net_nop_seconds(void);
@@ -45,6 +45,9 @@ void vtrace(const char *fmt, ...) printflike(1, 2);
 void ntvtrace(const char *fmt, ...) printflike(1, 2);
 void trace_set_trace_file(const char *path);
 void trace_rollover_check(void);
+void trace_flush(void);
+bool trace_netdata_binary(char direction, const unsigned char *buf,
+	size_t len);
 void tracefile_ok(const char *tfn);
 #if defined(_WIN32) /*[*/
 const char *default_trace_dir(void);
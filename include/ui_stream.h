@@ -32,6 +32,7 @@
  *		UI data stream I/O.
  */
 
+void ui_flush(void);
 void ui_io_init(void);
 void ui_leaf(const char *name, const char *args[]);
 void ui_pop(void);
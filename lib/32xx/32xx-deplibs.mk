@@ -0,0 +1,2 @@
+# lib32xx depends on various libraries found by autoconf.
+LIB32XX_DEPLIBS =  -lssl -lcrypto  
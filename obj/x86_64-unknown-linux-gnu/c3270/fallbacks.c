@@ -0,0 +1,598 @@
+/* This file was created automatically by mkfb. */
+
+#include "globals.h"
+#include "fallbacks.h"
+static unsigned char fsd[] = {
+109,101,115,115, 97,103,101, 46,102,116, 67,111,109,112,108,101,116,101, 58,
+ 32, 84,114, 97,110,115,102,101,114, 32, 99,111,109,112,108,101,116,101, 44,
+ 32, 37,105, 32, 98,121,116,101,115, 32,116,114, 97,110,115,102,101,114,114,
+101,100, 10, 37,115, 98,121,116,101,115, 47,115,101, 99, 32,105,110, 32, 37,
+115, 32,109,111,100,101,  0,109,101,115,115, 97,103,101, 46,102,116, 85,110,
+ 97, 98,108,101, 58, 32, 67, 97,110,110,111,116, 32, 98,101,103,105,110, 32,
+116,114, 97,110,115,102,101,114,  0,109,101,115,115, 97,103,101, 46,102,116,
+ 83,116, 97,114,116, 84,105,109,101,111,117,116, 58, 32, 84,114, 97,110,115,
+102,101,114, 32,100,105,100, 32,110,111,116, 32,115,116, 97,114,116, 32,119,
+105,116,104,105,110, 32, 49, 48,115,  0,109,101,115,115, 97,103,101, 46,102,
+116, 85,115,101,114, 67, 97,110, 99,101,108, 58, 32, 84,114, 97,110,115,102,
+101,114, 32, 99, 97,110, 99,101,108,108,101,100, 32, 98,121, 32,117,115,101,
+114,  0,109,101,115,115, 97,103,101, 46,102,116, 72,111,115,116, 67, 97,110,
+ 99,101,108, 58, 32, 84,114, 97,110,115,102,101,114, 32, 99, 97,110, 99,101,
+108,108,101,100, 32, 98,121, 32,104,111,115,116,  0,109,101,115,115, 97,103,
+101, 46,102,116, 67,117,116, 85,110,107,110,111,119,110, 70,114, 97,109,101,
+ 58, 32, 85,110,107,110,111,119,110, 32,102,114, 97,109,101, 32,116,121,112,
+101, 32,102,114,111,109, 32,104,111,115,116,  0,109,101,115,115, 97,103,101,
+ 46,102,116, 67,117,116, 85,110,107,110,111,119,110, 67,111,110,116,114,111,
+108, 58, 32, 85,110,107,110,111,119,110, 32, 70, 84, 32, 99,111,110,116,114,
+111,108, 32, 99,111,100,101, 32,102,114,111,109, 32,104,111,115,116,  0,109,
+101,115,115, 97,103,101, 46,102,116, 67,117,116, 82,101,116,114, 97,110,115,
+109,105,116, 58, 32, 84,114, 97,110,115,109,105,115,115,105,111,110, 32,101,
+114,114,111,114,  0,109,101,115,115, 97,103,101, 46,102,116, 67,117,116, 67,
+111,110,118,101,114,115,105,111,110, 69,114,114,111,114, 58, 32, 68, 97,116,
+ 97, 32, 99,111,110,118,101,114,115,105,111,110, 32,101,114,114,111,114,  0,
+109,101,115,115, 97,103,101, 46,102,116, 67,117,116, 79,118,101,114,115,105,
+122,101, 58, 32, 73,108,108,101,103, 97,108, 32,102,114, 97,109,101, 32,108,
+101,110,103,116,104,  0,109,101,115,115, 97,103,101, 46,102,116, 68,105,115,
+ 99,111,110,110,101, 99,116,101,100, 58, 32, 72,111,115,116, 32,100,105,115,
+ 99,111,110,110,101, 99,116,101,100, 44, 32,116,114, 97,110,115,102,101,114,
+ 32, 99, 97,110, 99,101,108,108,101,100,  0,109,101,115,115, 97,103,101, 46,
+102,116, 78,111,116, 51, 50, 55, 48, 58, 32, 78,111,116, 32,105,110, 32, 51,
+ 50, 55, 48, 32,109,111,100,101, 44, 32,116,114, 97,110,115,102,101,114, 32,
+ 99, 97,110, 99,101,108,108,101,100,  0,109,101,115,115, 97,103,101, 46,102,
+116, 68,102,116, 85,110,107,110,111,119,110, 79,112,101,110, 58, 32, 85,110,
+107,110,111,119,110, 32, 68, 70, 84, 32, 79,112,101,110, 32,116,121,112,101,
+ 32,102,114,111,109, 32,104,111,115,116,  0,112,114,105,110,116, 84,101,120,
+116, 67,111,109,109, 97,110,100, 58, 32,108,112,114, 32, 45, 74, 32, 34, 37,
+ 69, 37, 32,115, 99,114,101,101,110, 34,  0,112,114,105,110,116,101,114, 46,
+ 99,111,109,109, 97,110,100, 58, 32,108,112,114,  0,112,114,105,110,116,101,
+114, 46, 97,115,115,111, 99, 67,111,109,109, 97,110,100, 76,105,110,101, 58,
+ 32,112,114, 51, 50, 56, 55, 32, 45, 97,115,115,111, 99, 32, 37, 76, 37, 32,
+ 45, 99,111,109,109, 97,110,100, 32, 34, 37, 67, 37, 34, 32, 37, 82, 37, 32,
+ 37, 80, 37, 32, 37, 86, 37, 32, 37, 83, 37, 32, 37, 79, 37, 32, 34, 37, 72,
+ 37, 34,  0,112,114,105,110,116,101,114, 46,108,117, 67,111,109,109, 97,110,
+100, 76,105,110,101, 58, 32,112,114, 51, 50, 56, 55, 32, 45, 99,111,109,109,
+ 97,110,100, 32, 34, 37, 67, 37, 34, 32, 37, 82, 37, 32, 37, 80, 37, 32, 37,
+ 86, 37, 32, 37, 83, 37, 32, 37, 79, 37, 32, 34, 37, 76, 37, 64, 37, 72, 37,
+ 34,  0,109,101,115,115, 97,103,101, 46,104,111,117,114, 58, 32,104,111,117,
+114,  0,109,101,115,115, 97,103,101, 46,104,111,117,114,115, 58, 32,104,111,
+117,114,115,  0,109,101,115,115, 97,103,101, 46,109,105,110,117,116,101, 58,
+ 32,109,105,110,117,116,101,  0,109,101,115,115, 97,103,101, 46,109,105,110,
+117,116,101,115, 58, 32,109,105,110,117,116,101,115,  0,109,101,115,115, 97,
+103,101, 46, 98,105,110,100, 80,108,117, 78, 97,109,101, 58, 32, 66, 73, 78,
+ 68, 32, 80, 76, 85, 32,110, 97,109,101, 58,  0,109,101,115,115, 97,103,101,
+ 46, 98,121,116,101, 58, 32, 98,121,116,101,  0,109,101,115,115, 97,103,101,
+ 46, 98,121,116,101,115, 58, 32, 98,121,116,101,115,  0,109,101,115,115, 97,
+103,101, 46, 99,104, 97,114, 77,111,100,101, 58, 32, 78, 86, 84, 32, 99,104,
+ 97,114, 97, 99,116,101,114, 32,109,111,100,101,  0,109,101,115,115, 97,103,
+101, 46, 99,111,108,117,109,110,115, 58, 32, 99,111,108,117,109,110,115,  0,
+109,101,115,115, 97,103,101, 46, 99,111,110,110,101, 99,116,101,100, 84,111,
+ 58, 32, 67,111,110,110,101, 99,116,101,100, 32,116,111, 58,  0,109,101,115,
+115, 97,103,101, 46, 99,111,110,110,101, 99,116,105,111,110, 80,101,110,100,
+105,110,103, 58, 32, 67,111,110,110,101, 99,116,105,111,110, 32,112,101,110,
+100,105,110,103, 32,116,111, 58,  0,109,101,115,115, 97,103,101, 46,100, 98,
+ 99,115, 67,103, 99,115,103,105,100, 58, 32, 72,111,115,116, 32, 68, 66, 67,
+ 83, 32, 67, 71, 67, 83, 71, 73, 68, 58,  0,109,101,115,115, 97,103,101, 46,
+100,101,102, 97,117,108,116, 67,104, 97,114, 97, 99,116,101,114, 83,101,116,
+ 58, 32, 68,101,102, 97,117,108,116, 32, 40,117,115, 41, 32, 69, 66, 67, 68,
+ 73, 67, 32, 99,104, 97,114, 97, 99,116,101,114, 32,115,101,116,  0,109,101,
+115,115, 97,103,101, 46,100,115, 77,111,100,101, 58, 32, 51, 50, 55, 48, 32,
+109,111,100,101,  0,109,101,115,115, 97,103,101, 46,101,120,116,101,110,100,
+101,100, 68,115, 58, 32,101,120,116,101,110,100,101,100, 32,100, 97,116, 97,
+ 32,115,116,114,101, 97,109,  0,109,101,115,115, 97,103,101, 46,102,117,108,
+108, 67,111,108,111,114, 58, 32, 99,111,108,111,114,  0,109,101,115,115, 97,
+103,101, 46,107,101,121, 98,111, 97,114,100, 77, 97,112, 58, 32, 75,101,121,
+ 98,111, 97,114,100, 32,109, 97,112, 58,  0,109,101,115,115, 97,103,101, 46,
+108,105,110,101, 77,111,100,101, 58, 32, 78, 86, 84, 32,108,105,110,101, 32,
+109,111,100,101,  0,109,101,115,115, 97,103,101, 46,108,111, 99, 97,108,101,
+ 67,111,100,101,115,101,116, 58, 32, 76,111, 99, 97,108,101, 32, 99,111,100,
+101,115,101,116, 58,  0,109,101,115,115, 97,103,101, 46,108,117, 78, 97,109,
+101, 58, 32, 76, 85, 32,110, 97,109,101, 58,  0,109,101,115,115, 97,103,101,
+ 46,109,111,100,101,108, 58, 32, 77,111,100,101,108,  0,109,101,115,115, 97,
+103,101, 46,109,111,110,111, 58, 32,109,111,110,111, 99,104,114,111,109,101,
+  0,109,101,115,115, 97,103,101, 46,114,101, 99,111,110,110,101, 99,116,105,
+110,103, 58, 32, 82,101, 99,111,110,110,101, 99,116,105,111,110, 32,112,101,
+110,100,105,110,103,  0,109,101,115,115, 97,103,101, 46,110,111,116, 67,111,
+110,110,101, 99,116,101,100, 58, 32, 78,111,116, 32, 99,111,110,110,101, 99,
+116,101,100,  0,109,101,115,115, 97,103,101, 46,112,111,114,116, 58, 32, 80,
+111,114,116, 58,  0,109,101,115,115, 97,103,101, 46,112,114,111,118,105,100,
+101,114, 58, 32, 80,114,111,118,105,100,101,114, 58,  0,109,101,115,115, 97,
+103,101, 46,112,114,111,120,121, 84,121,112,101, 58, 32, 80,114,111,120,121,
+ 32,116,121,112,101, 58,  0,109,101,115,115, 97,103,101, 46, 82,101, 99,101,
+105,118,101,100, 58, 32, 82,101, 99,101,105,118,101,100,  0,109,101,115,115,
+ 97,103,101, 46,114,101, 99,101,105,118,101,100, 58, 32,114,101, 99,101,105,
+118,101,100,  0,109,101,115,115, 97,103,101, 46,114,101, 99,111,114,100, 58,
+ 32,114,101, 99,111,114,100,  0,109,101,115,115, 97,103,101, 46,114,111,119,
+115, 58, 32,114,111,119,115,  0,109,101,115,115, 97,103,101, 46,115, 98, 99,
+115, 67,103, 99,115,103,105,100, 58, 32, 72,111,115,116, 32, 83, 66, 67, 83,
+ 32, 67, 71, 67, 83, 71, 73, 68, 58,  0,109,101,115,115, 97,103,101, 46,114,
+101, 99,111,114,100,115, 58, 32,114,101, 99,111,114,100,115,  0,109,101,115,
+115, 97,103,101, 46,115,101, 99,111,110,100, 58, 32,115,101, 99,111,110,100,
+  0,109,101,115,115, 97,103,101, 46,115,101, 99,111,110,100,115, 58, 32,115,
+101, 99,111,110,100,115,  0,109,101,115,115, 97,103,101, 46,115,101, 99,117,
+114,101, 58, 32,118,105, 97, 32, 84, 76, 83, 47, 83, 83, 76,  0,109,101,115,
+115, 97,103,101, 46,115,101,110,116, 58, 32, 83,101,110,116,  0,109,101,115,
+115, 97,103,101, 46,115,101,114,118,101,114, 58, 32, 83,101,114,118,101,114,
+ 58,  0,109,101,115,115, 97,103,101, 46,115,101,114,118,101,114, 67,101,114,
+116, 58, 32, 72,111,115,116, 32, 99,101,114,116,105,102,105, 99, 97,116,101,
+ 58,  0,109,101,115,115, 97,103,101, 46,115,101,115,115,105,111,110, 73,110,
+102,111, 58, 32, 83,101,115,115,105,111,110, 32,105,110,102,111,114,109, 97,
+116,105,111,110, 58,  0,109,101,115,115, 97,103,101, 46,115,112,101, 99,105,
+ 97,108, 67,104, 97,114, 97, 99,116,101,114,115, 58, 32, 83,112,101, 99,105,
+ 97,108, 32, 99,104, 97,114, 97, 99,116,101,114,115, 58,  0,109,101,115,115,
+ 97,103,101, 46,115,115, 99,112, 77,111,100,101, 58, 32, 83, 83, 67, 80, 45,
+ 76, 85, 32,109,111,100,101,  0,109,101,115,115, 97,103,101, 46,115,116, 97,
+110,100, 97,114,100, 68,115, 58, 32,115,116, 97,110,100, 97,114,100, 32,100,
+ 97,116, 97, 32,115,116,114,101, 97,109,  0,109,101,115,115, 97,103,101, 46,
+116,101,114,109,105,110, 97,108, 78, 97,109,101, 58, 32, 84,101,114,109,105,
+110, 97,108, 32,110, 97,109,101, 58,  0,109,101,115,115, 97,103,101, 46,116,
+110, 51, 50, 55, 48,101, 78,111, 79,112,116,115, 58, 32, 78,111, 32, 84, 78,
+ 51, 50, 55, 48, 69, 32,111,112,116,105,111,110,115,  0,109,101,115,115, 97,
+103,101, 46,116,110, 51, 50, 55, 48,101, 79,112,116,115, 58, 32, 84, 78, 51,
+ 50, 55, 48, 69, 32,111,112,116,105,111,110,115, 58,  0,109,101,115,115, 97,
+103,101, 46,117,110, 98,111,117,110,100, 77,111,100,101, 58, 32,117,110, 98,
+111,117,110,100, 32,109,111,100,101,  0,109,101,115,115, 97,103,101, 46,117,
+110,118,101,114,105,102,105,101,100, 58, 32,117,110,118,101,114,105,102,105,
+101,100,  0,109,101,115,115, 97,103,101, 46,117,115,101,114, 58, 32, 85,115,
+101,114, 58,  0, 99,111,109,112,111,115,101, 77, 97,112, 46,108, 97,116,105,
+110, 49, 58, 32, 99, 32, 43, 32, 98, 97,114, 32, 61, 32, 99,101,110,116, 32,
+ 10, 99, 32, 43, 32,115,108, 97,115,104, 32, 61, 32, 99,101,110,116, 32, 10,
+ 76, 32, 43, 32,109,105,110,117,115, 32, 61, 32,115,116,101,114,108,105,110,
+103, 32, 10, 89, 32, 43, 32,101,113,117, 97,108, 32, 61, 32,121,101,110, 32,
+ 10, 83, 32, 43, 32, 83, 32, 61, 32,115,101, 99,116,105,111,110, 32, 10, 67,
+ 32, 43, 32, 79, 32, 61, 32, 99,111,112,121,114,105,103,104,116, 32, 10, 97,
+ 32, 43, 32,117,110,100,101,114,115, 99,111,114,101, 32, 61, 32,111,114,100,
+102,101,109,105,110,105,110,101, 32, 10,108,101,115,115, 32, 43, 32,108,101,
+115,115, 32, 61, 32,103,117,105,108,108,101,109,111,116,108,101,102,116, 32,
+ 10, 82, 32, 43, 32, 79, 32, 61, 32,114,101,103,105,115,116,101,114,101,100,
+ 32, 10,112,108,117,115, 32, 43, 32,109,105,110,117,115, 32, 61, 32,112,108,
+117,115,109,105,110,117,115, 32, 10,111, 32, 43, 32,117,110,100,101,114,115,
+ 99,111,114,101, 32, 61, 32,109, 97,115, 99,117,108,105,110,101, 32, 10,103,
+114,101, 97,116,101,114, 32, 43, 32,103,114,101, 97,116,101,114, 32, 61, 32,
+103,117,105,108,108,101,109,111,116,114,105,103,104,116, 32, 10, 49, 32, 43,
+ 32, 52, 32, 61, 32,111,110,101,113,117, 97,114,116,101,114, 32, 10, 49, 32,
+ 43, 32, 50, 32, 61, 32,111,110,101,104, 97,108,102, 32, 10, 51, 32, 43, 32,
+ 52, 32, 61, 32,116,104,114,101,101,113,117, 97,114,116,101,114,115, 32, 10,
+ 98, 97,114, 32, 43, 32, 98, 97,114, 32, 61, 32, 98,114,111,107,101,110, 98,
+ 97,114, 32, 10, 65, 32, 43, 32,103,114, 97,118,101, 32, 61, 32, 65,103,114,
+ 97,118,101, 32, 10, 65, 32, 43, 32, 97,112,111,115,116,114,111,112,104,101,
+ 32, 61, 32, 65, 97, 99,117,116,101, 32, 10, 65, 32, 43, 32, 97,115, 99,105,
+105, 99,105,114, 99,117,109, 32, 61, 32, 65, 99,105,114, 99,117,109,102,108,
+101,120, 32, 10, 65, 32, 43, 32, 97,115, 99,105,105,116,105,108,100,101, 32,
+ 61, 32, 65,116,105,108,100,101, 32, 10, 65, 32, 43, 32,113,117,111,116,101,
+100, 98,108, 32, 61, 32, 65,100,105, 97,101,114,101,115,105,115, 32, 10, 65,
+ 32, 43, 32, 97,115,116,101,114,105,115,107, 32, 61, 32, 65,114,105,110,103,
+ 32, 10, 65, 32, 43, 32, 69, 32, 61, 32, 65, 69, 32, 10, 67, 32, 43, 32, 99,
+111,109,109, 97, 32, 61, 32, 67, 99,101,100,105,108,108, 97, 32, 10, 67, 32,
+ 43, 32, 97,112,111,115,116,114,111,112,104,101, 32, 61, 32, 67, 99,101,100,
+105,108,108, 97, 32, 10, 69, 32, 43, 32,103,114, 97,118,101, 32, 61, 32, 69,
+103,114, 97,118,101, 32, 10, 69, 32, 43, 32, 97,112,111,115,116,114,111,112,
+104,101, 32, 61, 32, 69, 97, 99,117,116,101, 32, 10, 69, 32, 43, 32, 97,115,
+ 99,105,105, 99,105,114, 99,117,109, 32, 61, 32, 69, 99,105,114, 99,117,109,
+102,108,101,120, 32, 10, 69, 32, 43, 32,113,117,111,116,101,100, 98,108, 32,
+ 61, 32, 69,100,105, 97,101,114,101,115,105,115, 32, 10, 73, 32, 43, 32,103,
+114, 97,118,101, 32, 61, 32, 73,103,114, 97,118,101, 32, 10, 73, 32, 43, 32,
+ 97,112,111,115,116,114,111,112,104,101, 32, 61, 32, 73, 97, 99,117,116,101,
+ 32, 10, 73, 32, 43, 32, 97,115, 99,105,105, 99,105,114, 99,117,109, 32, 61,
+ 32, 73, 99,105,114, 99,117,109,102,108,101,120, 32, 10, 73, 32, 43, 32,113,
+117,111,116,101,100, 98,108, 32, 61, 32, 73,100,105, 97,101,114,101,115,105,
+115, 32, 10, 78, 32, 43, 32, 97,115, 99,105,105,116,105,108,100,101, 32, 61,
+ 32, 78,116,105,108,100,101, 32, 10, 79, 32, 43, 32,103,114, 97,118,101, 32,
+ 61, 32, 79,103,114, 97,118,101, 32, 10, 79, 32, 43, 32, 97,112,111,115,116,
+114,111,112,104,101, 32, 61, 32, 79, 97, 99,117,116,101, 32, 10, 79, 32, 43,
+ 32, 97,115, 99,105,105, 99,105,114, 99,117,109, 32, 61, 32, 79, 99,105,114,
+ 99,117,109,102,108,101,120, 32, 10, 79, 32, 43, 32, 97,115, 99,105,105,116,
+105,108,100,101, 32, 61, 32, 79,116,105,108,100,101, 32, 10, 79, 32, 43, 32,
+113,117,111,116,101,100, 98,108, 32, 61, 32, 79,100,105, 97,101,114,101,115,
+105,115, 32, 10, 79, 32, 43, 32,115,108, 97,115,104, 32, 61, 32, 79,111, 98,
+108,105,113,117,101, 32, 10, 85, 32, 43, 32,103,114, 97,118,101, 32, 61, 32,
+ 85,103,114, 97,118,101, 32, 10, 85, 32, 43, 32, 97,112,111,115,116,114,111,
+112,104,101, 32, 61, 32, 85, 97, 99,117,116,101, 32, 10, 85, 32, 43, 32, 97,
+115, 99,105,105, 99,105,114, 99,117,109, 32, 61, 32, 85, 99,105,114, 99,117,
+109,102,108,101,120, 32, 10, 85, 32, 43, 32,113,117,111,116,101,100, 98,108,
+ 32, 61, 32, 85,100,105, 97,101,114,101,115,105,115, 32, 10, 89, 32, 43, 32,
+ 97,112,111,115,116,114,111,112,104,101, 32, 61, 32, 89, 97, 99,117,116,101,
+ 32, 10,115, 32, 43, 32,115, 32, 61, 32,115,115,104, 97,114,112, 32, 10, 97,
+ 32, 43, 32,103,114, 97,118,101, 32, 61, 32, 97,103,114, 97,118,101, 32, 10,
+ 97, 32, 43, 32, 97,112,111,115,116,114,111,112,104,101, 32, 61, 32, 97, 97,
+ 99,117,116,101, 32, 10, 97, 32, 43, 32, 97,115, 99,105,105, 99,105,114, 99,
+117,109, 32, 61, 32, 97, 99,105,114, 99,117,109,102,108,101,120, 32, 10, 97,
+ 32, 43, 32, 97,115, 99,105,105,116,105,108,100,101, 32, 61, 32, 97,116,105,
+108,100,101, 32, 10, 97, 32, 43, 32,113,117,111,116,101,100, 98,108, 32, 61,
+ 32, 97,100,105, 97,101,114,101,115,105,115, 32, 10, 97, 32, 43, 32, 97,115,
+116,101,114,105,115,107, 32, 61, 32, 97,114,105,110,103, 32, 10, 97, 32, 43,
+ 32,101, 32, 61, 32, 97,101, 32, 10, 99, 32, 43, 32, 99,111,109,109, 97, 32,
+ 61, 32, 99, 99,101,100,105,108,108, 97, 32, 10, 99, 32, 43, 32, 97,112,111,
+115,116,114,111,112,104,101, 32, 61, 32, 99, 99,101,100,105,108,108, 97, 32,
+ 10,101, 32, 43, 32,103,114, 97,118,101, 32, 61, 32,101,103,114, 97,118,101,
+ 32, 10,101, 32, 43, 32, 97,112,111,115,116,114,111,112,104,101, 32, 61, 32,
+101, 97, 99,117,116,101, 32, 10,101, 32, 43, 32, 97,115, 99,105,105, 99,105,
+114, 99,117,109, 32, 61, 32,101, 99,105,114, 99,117,109,102,108,101,120, 32,
+ 10,101, 32, 43, 32,113,117,111,116,101,100, 98,108, 32, 61, 32,101,100,105,
+ 97,101,114,101,115,105,115, 32, 10,105, 32, 43, 32,103,114, 97,118,101, 32,
+ 61, 32,105,103,114, 97,118,101, 32, 10,105, 32, 43, 32, 97,112,111,115,116,
+114,111,112,104,101, 32, 61, 32,105, 97, 99,117,116,101, 32, 10,105, 32, 43,
+ 32, 97,115, 99,105,105, 99,105,114, 99,117,109, 32, 61, 32,105, 99,105,114,
+ 99,117,109,102,108,101,120, 32, 10,105, 32, 43, 32,113,117,111,116,101,100,
+ 98,108, 32, 61, 32,105,100,105, 97,101,114,101,115,105,115, 32, 10,110, 32,
+ 43, 32, 97,115, 99,105,105,116,105,108,100,101, 32, 61, 32,110,116,105,108,
+100,101, 32, 10,111, 32, 43, 32,103,114, 97,118,101, 32, 61, 32,111,103,114,
+ 97,118,101, 32, 10,111, 32, 43, 32, 97,112,111,115,116,114,111,112,104,101,
+ 32, 61, 32,111, 97, 99,117,116,101, 32, 10,111, 32, 43, 32, 97,115, 99,105,
+105, 99,105,114, 99,117,109, 32, 61, 32,111, 99,105,114, 99,117,109,102,108,
+101,120, 32, 10,111, 32, 43, 32, 97,115, 99,105,105,116,105,108,100,101, 32,
+ 61, 32,111,116,105,108,100,101, 32, 10,111, 32, 43, 32,113,117,111,116,101,
+100, 98,108, 32, 61, 32,111,100,105, 97,101,114,101,115,105,115, 32, 10,111,
+ 32, 43, 32,115,108, 97,115,104, 32, 61, 32,111,115,108, 97,115,104, 32, 10,
+117, 32, 43, 32,103,114, 97,118,101, 32, 61, 32,117,103,114, 97,118,101, 32,
+ 10,117, 32, 43, 32, 97,112,111,115,116,114,111,112,104,101, 32, 61, 32,117,
+ 97, 99,117,116,101, 32, 10,117, 32, 43, 32, 97,115, 99,105,105, 99,105,114,
+ 99,117,109, 32, 61, 32,117, 99,105,114, 99,117,109,102,108,101,120, 32, 10,
+117, 32, 43, 32,113,117,111,116,101,100, 98,108, 32, 61, 32,117,100,105, 97,
+101,114,101,115,105,115, 32, 10,121, 32, 43, 32, 97,112,111,115,116,114,111,
+112,104,101, 32, 61, 32,121, 97, 99,117,116,101, 32, 10,121, 32, 43, 32,113,
+117,111,116,101,100, 98,108, 32, 61, 32,121,100,105, 97,101,114,101,115,105,
+115, 32, 10, 97,112,111,115,116,114,111,112,104,101, 32, 43, 32, 97,112,111,
+115,116,114,111,112,104,101, 32, 61, 32, 97,112,111,115,116,114,111,112,104,
+101, 32, 10, 97,112,111,115,116,114,111,112,104,101, 32, 43, 32,115,112, 97,
+ 99,101, 32, 61, 32, 97,112,111,115,116,114,111,112,104,101, 32, 10, 97,115,
+ 99,105,105, 99,105,114, 99,117,109, 32, 43, 32, 97,115, 99,105,105, 99,105,
+114, 99,117,109, 32, 61, 32, 97,115, 99,105,105, 99,105,114, 99,117,109, 32,
+ 10, 97,115, 99,105,105, 99,105,114, 99,117,109, 32, 43, 32,115,112, 97, 99,
+101, 32, 61, 32, 97,115, 99,105,105, 99,105,114, 99,117,109, 32, 10, 97,115,
+ 99,105,105,116,105,108,100,101, 32, 43, 32, 97,115, 99,105,105,116,105,108,
+100,101, 32, 61, 32, 97,115, 99,105,105,116,105,108,100,101, 32, 10, 97,115,
+ 99,105,105,116,105,108,100,101, 32, 43, 32,115,112, 97, 99,101, 32, 61, 32,
+ 97,115, 99,105,105,116,105,108,100,101, 32, 10,103,114, 97,118,101, 32, 43,
+ 32,103,114, 97,118,101, 32, 61, 32,103,114, 97,118,101, 32, 10,103,114, 97,
+118,101, 32, 43, 32,115,112, 97, 99,101, 32, 61, 32,103,114, 97,118,101, 32,
+ 10,113,117,111,116,101,100, 98,108, 32, 43, 32,113,117,111,116,101,100, 98,
+108, 32, 61, 32,113,117,111,116,101,100, 98,108, 32, 10,113,117,111,116,101,
+100, 98,108, 32, 43, 32,115,112, 97, 99,101, 32, 61, 32,113,117,111,116,101,
+100, 98,108, 32, 10,  0,109,101,115,115, 97,103,101, 46, 98,117,105,108,100,
+ 68,105,115, 97, 98,108,101,100, 58, 32,100,105,115, 97, 98,108,101,100,  0,
+109,101,115,115, 97,103,101, 46, 98,117,105,108,100, 69,110, 97, 98,108,101,
+100, 58, 32,101,110, 97, 98,108,101,100,  0,109,101,115,115, 97,103,101, 46,
+ 98,117,105,108,100, 79,112,116,115, 58, 32, 66,117,105,108,100, 32,111,112,
+116,105,111,110,115, 58,  0,109,101,115,115, 97,103,101, 46,104,111,115,116,
+ 67,111,100,101, 80, 97,103,101, 58, 32, 72,111,115,116, 32, 99,111,100,101,
+ 32,112, 97,103,101, 58,  0,109,101,115,115, 97,103,101, 46,117,110,110,101,
+103,111,116,105, 97,116,101,100, 58, 32, 84, 69, 76, 78, 69, 84, 32,110,101,
+103,111,116,105, 97,116,105,111,110, 32,105,110, 99,111,109,112,108,101,116,
+101,  0,107,101,121,109, 97,112, 46, 98, 97,115,101, 58, 32, 10, 67,116,114,
+108, 60, 75,101,121, 62, 93, 58, 32, 69,115, 99, 97,112,101, 40, 41, 10, 60,
+ 75,101,121, 62, 69,115, 99, 97,112,101, 58, 32, 69,115, 99, 97,112,101, 40,
+ 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97, 32, 67,116,114,108, 60, 75,
+101,121, 62, 97, 58, 32, 75,101,121, 40, 48,120, 48, 49, 41, 10, 67,116,114,
+108, 60, 75,101,121, 62, 97, 32, 67,116,114,108, 60, 75,101,121, 62, 93, 58,
+ 32, 75,101,121, 40, 48,120, 49,100, 41, 10, 67,116,114,108, 60, 75,101,121,
+ 62, 97, 32, 60, 75,101,121, 62, 99, 58, 32, 67,108,101, 97,114, 40, 41, 10,
+ 67,116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62,101, 58, 32,
+ 69,115, 99, 97,112,101, 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97,
+ 32, 60, 75,101,121, 62,105, 58, 32, 83,101,116, 40,105,110,115,101,114,116,
+ 77,111,100,101, 44,116,114,117,101, 41, 10, 67,116,114,108, 60, 75,101,121,
+ 62, 97, 32, 60, 75,101,121, 62,114, 58, 32, 82,101,115,101,116, 40, 41, 10,
+ 67,116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62,107, 58, 32,
+ 75,101,121,112, 97,100, 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97,
+ 32, 60, 75,101,121, 62,108, 58, 32, 82,101,100,114, 97,119, 40, 41, 10, 67,
+116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62,109, 58, 32, 67,
+111,109,112,111,115,101, 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97,
+ 32, 60, 75,101,121, 62,110, 58, 32, 77,101,110,117, 40, 41, 10, 67,116,114,
+108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62,112, 58, 32, 80,114,105,
+110,116, 84,101,120,116, 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97,
+ 32, 60, 75,101,121, 62,113, 58, 32, 81,117,105,116, 40, 41, 10, 67,116,114,
+108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62, 94, 58, 32, 75,101,121,
+ 40,110,111,116,115,105,103,110, 41, 10, 60, 75,101,121, 62, 68, 67, 58, 32,
+ 68,101,108,101,116,101, 40, 41, 10, 60, 75,101,121, 62, 85, 80, 58, 32, 85,
+112, 40, 41, 10, 60, 75,101,121, 62, 68, 79, 87, 78, 58, 32, 68,111,119,110,
+ 40, 41, 10, 60, 75,101,121, 62, 76, 69, 70, 84, 58, 32, 76,101,102,116, 40,
+ 41, 10, 60, 75,101,121, 62, 82, 73, 71, 72, 84, 58, 32, 82,105,103,104,116,
+ 40, 41, 10, 60, 75,101,121, 62, 72, 79, 77, 69, 58, 32, 72,111,109,101, 40,
+ 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62, 49,
+ 58, 32, 80, 65, 40, 49, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97, 32,
+ 60, 75,101,121, 62, 50, 58, 32, 80, 65, 40, 50, 41, 10, 67,116,114,108, 60,
+ 75,101,121, 62, 97, 32, 60, 75,101,121, 62, 51, 58, 32, 80, 65, 40, 51, 41,
+ 10, 60, 75,101,121, 62, 70, 49, 58, 32, 80, 70, 40, 49, 41, 10, 67,116,114,
+108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62, 70, 49, 58, 32, 80, 70,
+ 40, 49, 51, 41, 10, 60, 75,101,121, 62, 70, 50, 58, 32, 80, 70, 40, 50, 41,
+ 10, 67,116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62, 70, 50,
+ 58, 32, 80, 70, 40, 49, 52, 41, 10, 60, 75,101,121, 62, 70, 51, 58, 32, 80,
+ 70, 40, 51, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,
+121, 62, 70, 51, 58, 32, 80, 70, 40, 49, 53, 41, 10, 60, 75,101,121, 62, 70,
+ 52, 58, 32, 80, 70, 40, 52, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97,
+ 32, 60, 75,101,121, 62, 70, 52, 58, 32, 80, 70, 40, 49, 54, 41, 10, 60, 75,
+101,121, 62, 70, 53, 58, 32, 80, 70, 40, 53, 41, 10, 67,116,114,108, 60, 75,
+101,121, 62, 97, 32, 60, 75,101,121, 62, 70, 53, 58, 32, 80, 70, 40, 49, 55,
+ 41, 10, 60, 75,101,121, 62, 70, 54, 58, 32, 80, 70, 40, 54, 41, 10, 67,116,
+114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62, 70, 54, 58, 32, 80,
+ 70, 40, 49, 56, 41, 10, 60, 75,101,121, 62, 70, 55, 58, 32, 80, 70, 40, 55,
+ 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62, 70,
+ 55, 58, 32, 80, 70, 40, 49, 57, 41, 10, 60, 75,101,121, 62, 70, 56, 58, 32,
+ 80, 70, 40, 56, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,
+101,121, 62, 70, 56, 58, 32, 80, 70, 40, 50, 48, 41, 10, 60, 75,101,121, 62,
+ 70, 57, 58, 32, 80, 70, 40, 57, 41, 10, 67,116,114,108, 60, 75,101,121, 62,
+ 97, 32, 60, 75,101,121, 62, 70, 57, 58, 32, 80, 70, 40, 50, 49, 41, 10, 60,
+ 75,101,121, 62, 70, 49, 48, 58, 32, 80, 70, 40, 49, 48, 41, 10, 67,116,114,
+108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62, 70, 49, 48, 58, 32, 80,
+ 70, 40, 50, 50, 41, 10, 60, 75,101,121, 62, 70, 49, 49, 58, 32, 80, 70, 40,
+ 49, 49, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121,
+ 62, 70, 49, 49, 58, 32, 80, 70, 40, 50, 51, 41, 10, 60, 75,101,121, 62, 70,
+ 49, 50, 58, 32, 80, 70, 40, 49, 50, 41, 10, 67,116,114,108, 60, 75,101,121,
+ 62, 97, 32, 60, 75,101,121, 62, 70, 49, 50, 58, 32, 80, 70, 40, 50, 52, 41,
+ 10, 60, 75,101,121, 62, 80, 80, 65, 71, 69, 58, 32, 83, 99,114,111,108,108,
+ 40, 98, 97, 99,107,119, 97,114,100, 41, 10, 60, 75,101,121, 62, 78, 80, 65,
+ 71, 69, 58, 32, 83, 99,114,111,108,108, 40,102,111,114,119, 97,114,100, 41,
+  0,107,101,121,109, 97,112, 46, 98, 97,115,101, 46, 51, 50, 55, 48, 58, 32,
+ 10, 67,116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62, 97, 58,
+ 32, 65,116,116,110, 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97, 32,
+ 67,116,114,108, 60, 75,101,121, 62,105, 58, 32, 66, 97, 99,107, 84, 97, 98,
+ 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 99, 58, 32, 67,108,101, 97,
+114, 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62,100, 58, 32, 68,117,112,
+ 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62,102, 58, 32, 70,105,101,108,
+100, 77, 97,114,107, 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62,104, 58,
+ 32, 69,114, 97,115,101, 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62,105,
+ 58, 32, 84, 97, 98, 40, 41, 10, 67,116,114,108, 60, 75,101,121, 62,106, 58,
+ 32, 78,101,119,108,105,110,101, 40, 41, 10, 67,116,114,108, 60, 75,101,121,
+ 62,107, 58, 32, 75,101,121,112, 97,100, 40, 41, 10, 67,116,114,108, 60, 75,
+101,121, 62,108, 58, 32, 82,101,100,114, 97,119, 40, 41, 10, 67,116,114,108,
+ 60, 75,101,121, 62,109, 58, 32, 69,110,116,101,114, 40, 41, 10, 67,116,114,
+108, 60, 75,101,121, 62,110, 58, 32, 77,101,110,117, 40, 41, 10, 67,116,114,
+108, 60, 75,101,121, 62,114, 58, 32, 82,101,115,101,116, 40, 41, 10, 67,116,
+114,108, 60, 75,101,121, 62,117, 58, 32, 68,101,108,101,116,101, 70,105,101,
+108,100, 40, 41, 10, 60, 75,101,121, 62, 73, 67, 58, 32, 84,111,103,103,108,
+101, 40,105,110,115,101,114,116, 77,111,100,101, 41, 10, 60, 75,101,121, 62,
+ 66, 65, 67, 75, 83, 80, 65, 67, 69, 58, 32, 69,114, 97,115,101, 40, 41, 10,
+ 60, 75,101,121, 62, 69, 78, 68, 58, 32, 70,105,101,108,100, 69,110,100, 40,
+ 41,  0,107,101,121,109, 97,112, 46,114,105,103,104,116,116,111,108,101,102,
+116, 58, 32, 67,116,114,108, 60, 75,101,121, 62, 97, 32, 60, 75,101,121, 62,
+118, 58, 32, 84,111,103,103,108,101, 40,114,101,118,101,114,115,101, 73,110,
+112,117,116, 77,111,100,101, 41, 10, 67,116,114,108, 60, 75,101,121, 62, 97,
+ 32, 60, 75,101,121, 62,102, 58, 32, 84,111,103,103,108,101, 40,114,105,103,
+104,116, 84,111, 76,101,102,116, 77,111,100,101, 41,  0,};
+
+char *fallbacks[232] = {
+	(char *)&fsd[0], /* line 31 */
+	(char *)&fsd[60], /* line 32 */
+	(char *)&fsd[83], /* line 33 */
+	(char *)&fsd[123], /* line 34 */
+	(char *)&fsd[181], /* line 35 */
+	(char *)&fsd[230], /* line 36 */
+	(char *)&fsd[279], /* line 37 */
+	(char *)&fsd[335], /* line 38 */
+	(char *)&fsd[398], /* line 39 */
+	(char *)&fsd[442], /* line 40 */
+	(char *)&fsd[494], /* line 41 */
+	(char *)&fsd[538], /* line 42 */
+	(char *)&fsd[600], /* line 43 */
+	(char *)&fsd[656], /* line 44 */
+	(char *)&fsd[714], /* line 72 */
+	(char *)&fsd[752], /* line 78 */
+	(char *)&fsd[773], /* line 79 */
+	(char *)&fsd[858], /* line 80 */
+	(char *)&fsd[933], /* line 110 */
+	(char *)&fsd[952], /* line 111 */
+	(char *)&fsd[973], /* line 112 */
+	(char *)&fsd[996], /* line 113 */
+	(char *)&fsd[1021], /* line 114 */
+	(char *)&fsd[1057], /* line 115 */
+	(char *)&fsd[1076], /* line 116 */
+	(char *)&fsd[1097], /* line 117 */
+	(char *)&fsd[1134], /* line 118 */
+	(char *)&fsd[1159], /* line 119 */
+	(char *)&fsd[1194], /* line 120 */
+	(char *)&fsd[1244], /* line 121 */
+	(char *)&fsd[1284], /* line 122 */
+	(char *)&fsd[1347], /* line 123 */
+	(char *)&fsd[1373], /* line 124 */
+	(char *)&fsd[1414], /* line 125 */
+	(char *)&fsd[1439], /* line 126 */
+	(char *)&fsd[1474], /* line 127 */
+	(char *)&fsd[1506], /* line 128 */
+	(char *)&fsd[1545], /* line 129 */
+	(char *)&fsd[1570], /* line 130 */
+	(char *)&fsd[1591], /* line 131 */
+	(char *)&fsd[1616], /* line 132 */
+	(char *)&fsd[1659], /* line 133 */
+	(char *)&fsd[1695], /* line 134 */
+	(char *)&fsd[1715], /* line 135 */
+	(char *)&fsd[1743], /* line 136 */
+	(char *)&fsd[1774], /* line 137 */
+	(char *)&fsd[1801], /* line 138 */
+	(char *)&fsd[1828], /* line 139 */
+	(char *)&fsd[1851], /* line 140 */
+	(char *)&fsd[1870], /* line 141 */
+	(char *)&fsd[1910], /* line 142 */
+	(char *)&fsd[1935], /* line 143 */
+	(char *)&fsd[1958], /* line 144 */
+	(char *)&fsd[1983], /* line 145 */
+	(char *)&fsd[2011], /* line 146 */
+	(char *)&fsd[2030], /* line 147 */
+	(char *)&fsd[2054], /* line 148 */
+	(char *)&fsd[2092], /* line 149 */
+	(char *)&fsd[2134], /* line 150 */
+	(char *)&fsd[2181], /* line 151 */
+	(char *)&fsd[2212], /* line 152 */
+	(char *)&fsd[2253], /* line 153 */
+	(char *)&fsd[2290], /* line 154 */
+	(char *)&fsd[2332], /* line 155 */
+	(char *)&fsd[2370], /* line 156 */
+	(char *)&fsd[2404], /* line 157 */
+	(char *)&fsd[2435], /* line 158 */
+	(char *)&fsd[2455], /* line 189 */
+	(char *)&fsd[2474], /* line 190 */
+	(char *)&fsd[2490], /* line 191 */
+	(char *)&fsd[2508], /* line 192 */
+	(char *)&fsd[2530], /* line 193 */
+	(char *)&fsd[2547], /* line 194 */
+	(char *)&fsd[2564], /* line 195 */
+	(char *)&fsd[2583], /* line 196 */
+	(char *)&fsd[2613], /* line 197 */
+	(char *)&fsd[2642], /* line 198 */
+	(char *)&fsd[2662], /* line 199 */
+	(char *)&fsd[2688], /* line 200 */
+	(char *)&fsd[2716], /* line 201 */
+	(char *)&fsd[2752], /* line 202 */
+	(char *)&fsd[2772], /* line 203 */
+	(char *)&fsd[2789], /* line 204 */
+	(char *)&fsd[2812], /* line 205 */
+	(char *)&fsd[2835], /* line 206 */
+	(char *)&fsd[2855], /* line 207 */
+	(char *)&fsd[2880], /* line 208 */
+	(char *)&fsd[2911], /* line 209 */
+	(char *)&fsd[2936], /* line 210 */
+	(char *)&fsd[2963], /* line 211 */
+	(char *)&fsd[2985], /* line 212 */
+	(char *)&fsd[2997], /* line 213 */
+	(char *)&fsd[3019], /* line 214 */
+	(char *)&fsd[3046], /* line 215 */
+	(char *)&fsd[3066], /* line 216 */
+	(char *)&fsd[3091], /* line 217 */
+	(char *)&fsd[3122], /* line 218 */
+	(char *)&fsd[3149], /* line 219 */
+	(char *)&fsd[3169], /* line 220 */
+	(char *)&fsd[3194], /* line 221 */
+	(char *)&fsd[3225], /* line 222 */
+	(char *)&fsd[3252], /* line 223 */
+	(char *)&fsd[3277], /* line 224 */
+	(char *)&fsd[3297], /* line 225 */
+	(char *)&fsd[3322], /* line 226 */
+	(char *)&fsd[3353], /* line 227 */
+	(char *)&fsd[3378], /* line 228 */
+	(char *)&fsd[3405], /* line 229 */
+	(char *)&fsd[3427], /* line 230 */
+	(char *)&fsd[3447], /* line 231 */
+	(char *)&fsd[3472], /* line 232 */
+	(char *)&fsd[3503], /* line 233 */
+	(char *)&fsd[3530], /* line 234 */
+	(char *)&fsd[3555], /* line 235 */
+	(char *)&fsd[3571], /* line 236 */
+	(char *)&fsd[3591], /* line 237 */
+	(char *)&fsd[3616], /* line 238 */
+	(char *)&fsd[3647], /* line 239 */
+	(char *)&fsd[3672], /* line 240 */
+	(char *)&fsd[3699], /* line 241 */
+	(char *)&fsd[3721], /* line 242 */
+	(char *)&fsd[3733], /* line 243 */
+	(char *)&fsd[3755], /* line 244 */
+	(char *)&fsd[3782], /* line 245 */
+	(char *)&fsd[3802], /* line 246 */
+	(char *)&fsd[3827], /* line 247 */
+	(char *)&fsd[3858], /* line 248 */
+	(char *)&fsd[3885], /* line 249 */
+	(char *)&fsd[3905], /* line 250 */
+	(char *)&fsd[3930], /* line 251 */
+	(char *)&fsd[3961], /* line 252 */
+	(char *)&fsd[3988], /* line 253 */
+	(char *)&fsd[4013], /* line 254 */
+	(char *)&fsd[4033], /* line 255 */
+	(char *)&fsd[4058], /* line 256 */
+	(char *)&fsd[4089], /* line 257 */
+	(char *)&fsd[4114], /* line 258 */
+	(char *)&fsd[4141], /* line 259 */
+	(char *)&fsd[4161], /* line 260 */
+	(char *)&fsd[4181], /* line 261 */
+	(char *)&fsd[4206], /* line 262 */
+	(char *)&fsd[4237], /* line 263 */
+	(char *)&fsd[4264], /* line 264 */
+	(char *)&fsd[4289], /* line 265 */
+	(char *)&fsd[4316], /* line 266 */
+	(char *)&fsd[4354], /* line 267 */
+	(char *)&fsd[4387], /* line 268 */
+	(char *)&fsd[4428], /* line 269 */
+	(char *)&fsd[4463], /* line 270 */
+	(char *)&fsd[4501], /* line 271 */
+	(char *)&fsd[4534], /* line 272 */
+	(char *)&fsd[4557], /* line 273 */
+	(char *)&fsd[4580], /* line 274 */
+	(char *)&fsd[4612], /* line 275 */
+	(char *)&fsd[4642], /* line 305 */
+	(char *)&fsd[4674], /* line 306 */
+	(char *)&fsd[4704], /* line 307 */
+	(char *)&fsd[4738], /* line 308 */
+	(char *)&fsd[4776], /* line 309 */
+	(char *)&fsd[4828], /* line 397 */
+	(char *)&fsd[4842], /* line 398 */
+	(char *)&fsd[4863], /* line 399 */
+	(char *)&fsd[4885], /* line 400 */
+	(char *)&fsd[4918], /* line 401 */
+	(char *)&fsd[4951], /* line 402 */
+	(char *)&fsd[4978], /* line 403 */
+	(char *)&fsd[5006], /* line 404 */
+	(char *)&fsd[5046], /* line 405 */
+	(char *)&fsd[5073], /* line 406 */
+	(char *)&fsd[5101], /* line 407 */
+	(char *)&fsd[5129], /* line 408 */
+	(char *)&fsd[5158], /* line 409 */
+	(char *)&fsd[5184], /* line 410 */
+	(char *)&fsd[5215], /* line 411 */
+	(char *)&fsd[5241], /* line 412 */
+	(char *)&fsd[5273], /* line 413 */
+	(char *)&fsd[5291], /* line 414 */
+	(char *)&fsd[5305], /* line 415 */
+	(char *)&fsd[5323], /* line 416 */
+	(char *)&fsd[5341], /* line 417 */
+	(char *)&fsd[5361], /* line 418 */
+	(char *)&fsd[5379], /* line 419 */
+	(char *)&fsd[5404], /* line 420 */
+	(char *)&fsd[5429], /* line 421 */
+	(char *)&fsd[5454], /* line 422 */
+	(char *)&fsd[5469], /* line 423 */
+	(char *)&fsd[5496], /* line 424 */
+	(char *)&fsd[5511], /* line 425 */
+	(char *)&fsd[5538], /* line 426 */
+	(char *)&fsd[5553], /* line 427 */
+	(char *)&fsd[5580], /* line 428 */
+	(char *)&fsd[5595], /* line 429 */
+	(char *)&fsd[5622], /* line 430 */
+	(char *)&fsd[5637], /* line 431 */
+	(char *)&fsd[5664], /* line 432 */
+	(char *)&fsd[5679], /* line 433 */
+	(char *)&fsd[5706], /* line 434 */
+	(char *)&fsd[5721], /* line 435 */
+	(char *)&fsd[5748], /* line 436 */
+	(char *)&fsd[5763], /* line 437 */
+	(char *)&fsd[5790], /* line 438 */
+	(char *)&fsd[5805], /* line 439 */
+	(char *)&fsd[5832], /* line 440 */
+	(char *)&fsd[5849], /* line 441 */
+	(char *)&fsd[5877], /* line 442 */
+	(char *)&fsd[5894], /* line 443 */
+	(char *)&fsd[5922], /* line 444 */
+	(char *)&fsd[5939], /* line 445 */
+	(char *)&fsd[5967], /* line 446 */
+	(char *)&fsd[5996], /* line 447 */
+	(char *)&fsd[6024], /* line 448 */
+	(char *)&fsd[6043], /* line 449 */
+	(char *)&fsd[6069], /* line 450 */
+	(char *)&fsd[6102], /* line 451 */
+	(char *)&fsd[6122], /* line 452 */
+	(char *)&fsd[6140], /* line 453 */
+	(char *)&fsd[6164], /* line 454 */
+	(char *)&fsd[6184], /* line 455 */
+	(char *)&fsd[6202], /* line 456 */
+	(char *)&fsd[6224], /* line 457 */
+	(char *)&fsd[6245], /* line 458 */
+	(char *)&fsd[6266], /* line 459 */
+	(char *)&fsd[6286], /* line 460 */
+	(char *)&fsd[6305], /* line 461 */
+	(char *)&fsd[6325], /* line 462 */
+	(char *)&fsd[6351], /* line 463 */
+	(char *)&fsd[6379], /* line 464 */
+	(char *)&fsd[6403], /* line 465 */
+	(char *)&fsd[6424], /* line 467 */
+	(char *)&fsd[6444], /* line 468 */
+	(char *)&fsd[6488], /* line 469 */
+	NULL
+};
+
+#if defined(DEBUG) /*[*/
+#include <stdio.h>
+int
+main(int argc, char *argv[])
+{
+	int i;
+
+	for (i = 0; fallbacks[i] != NULL; i++)
+		printf("%d: %s\n", i, fallbacks[i]);
+	return 0;
+}
+#endif /*]*/
+
@@ -0,0 +1,807 @@
+unsigned char favicon[] = {
+  0,  0,  1,  0,  1,  0, 64, 64,  0,  0,  0,  0,  0,  0, 40, 50,
+  0,  0, 22,  0,  0,  0, 40,  0,  0,  0, 64,  0,  0,  0,128,  0,
+  0,  0,  1,  0, 24,  0,  0,  0,  0,  0,  0, 50,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,166,178,157,173,183,
+148,165,177,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,125,
+144,159,133,152,165,121,141,156,114,135,150, 89,110,126,101,125,
+142, 98,122,139, 98,122,139, 98,122,139,104,127,143,105,128,144,
+115,137,153,134,154,167,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,183,194,202,164,176,186,147,162,173,123,143,157, 93,116,
+132, 90,112,129,127,147,161,116,137,152,111,131,146,115,135,150,
+114,135,150,114,135,150,110,132,148, 97,121,137, 91,116,133, 98,
+122,138,100,124,141,106,129,145,105,129,145, 97,121,137,109,133,
+148,110,133,148,114,136,152,117,139,154,118,140,156,118,140,155,
+119,141,157,115,138,154,122,143,157,134,153,166,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,163,174,183,141,153,163,115,133,147,
+ 88,110,126, 68, 87,103, 67, 86,102, 83,104,120, 89,111,127, 88,
+110,127, 92,115,132, 89,113,130, 93,117,133, 94,118,135, 97,120,
+137, 98,122,138,104,127,143,103,126,143,102,126,142,104,127,143,
+106,128,145,110,133,149,109,133,148,113,135,151,115,138,153,120,
+142,157,125,146,161,133,153,167,138,158,171,130,150,165,138,158,
+172,141,161,174,147,166,179,148,166,180,146,165,178,149,168,181,
+129,150,165,115,138,153,114,137,152,114,136,152,111,134,149,131,
+151,164,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,134,152,164, 74, 97,114, 70, 93,110, 72, 95,113,
+ 74, 98,115, 81,105,122, 82,106,123, 98,121,138,102,125,142,101,
+124,140,104,127,143,105,128,144,112,134,149,117,138,153,121,142,
+157,122,144,159,127,148,162,129,149,164,128,149,163,125,146,162,
+126,147,162,130,151,165,130,151,165,130,151,166,134,154,169,136,
+157,170,139,158,172,139,159,172,142,162,175,138,158,172,132,152,
+167,142,162,175,144,163,177,145,164,177,143,162,176,147,165,179,
+145,164,178,117,139,155,113,136,152,118,140,156,118,140,155,119,
+140,156,152,168,181,175,188,197,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,146,164,175,103,125,141,105,127,142,107,130,146,
+109,131,147,116,138,153,120,142,156,132,153,167,134,155,168,135,
+155,169,135,155,169,136,156,170,139,158,172,139,159,172,135,155,
+170,132,153,167,130,151,166,132,152,167,128,149,164,128,149,164,
+126,148,163,126,148,163,123,145,160,124,145,160,124,145,160,129,
+150,165,127,148,163,127,148,163,132,153,167,134,154,169,132,152,
+167,133,153,168,142,161,175,139,158,173,138,158,173,142,161,175,
+150,168,181,138,158,171,117,138,154,126,147,162,129,150,165,128,
+149,164,124,145,161,134,154,168,147,166,178,189,200,207,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,180,193,202,142,162,175,143,162,176,142,162,175,
+143,163,177,147,165,179,146,165,178,146,166,178,148,167,180,146,
+165,179,141,161,175,139,158,173,135,156,170,128,149,164,122,144,
+159,118,140,156,120,142,157,118,140,156,115,138,153,117,139,154,
+116,137,152,119,141,157,116,138,153,115,135,150,115,133,147,121,
+138,151,120,137,150,123,140,152,121,139,151,115,133,146,105,124,
+138, 87,103,116,122,139,151,138,158,172,133,152,166,134,152,164,
+139,155,165,146,165,178,133,153,167,124,144,160,134,154,169,135,
+155,169,133,153,168,132,152,167,138,158,172,146,165,178,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,168,185,195,151,170,183,147,166,179,
+146,165,178,147,166,179,148,167,180,146,165,179,142,161,175,141,
+158,170,133,151,163,130,148,161,125,144,157,115,135,149,107,128,
+143,101,121,136, 94,112,125, 83,101,113, 74, 91,105, 81, 98,110,
+ 55, 69, 80, 49, 59, 68, 33, 45, 54, 20, 31, 42, 12, 20, 27, 14,
+ 20, 26, 12, 18, 24, 13, 20, 27, 17, 23, 29, 13, 20, 26, 12, 22,
+ 32,  7, 16, 26, 33, 43, 52, 62, 77, 90, 32, 42, 52, 19, 28, 38,
+ 13, 20, 27, 86,101,113,138,157,171,123,144,159,128,148,163,140,
+160,173,141,161,174,139,159,173,141,161,175,142,162,176,195,206,
+213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,176,190,200,148,166,179,
+142,161,175,146,166,179,152,170,183,146,165,179,149,167,180, 93,
+103,111, 56, 64, 73, 56, 62, 71, 59, 67, 74, 46, 56, 65, 37, 47,
+ 56, 27, 38, 48, 19, 26, 34, 15, 20, 25, 14, 21, 27, 17, 26, 35,
+ 17, 27, 38, 21, 28, 38, 24, 33, 42, 26, 38, 48, 34, 46, 57, 51,
+ 64, 74, 59, 72, 81, 72, 86, 98, 84, 98,109, 36, 44, 52, 10, 19,
+ 30, 11, 21, 32, 20, 30, 39, 42, 51, 59, 11, 17, 24, 13, 23, 34,
+ 11, 22, 33, 24, 33, 42, 84, 98,109,132,153,168,126,147,162,136,
+156,170,142,161,175,141,161,175,148,167,180,149,168,181,190,201,
+209,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,175,189,199,
+141,161,174,149,168,181,132,149,160, 90,106,117, 78, 90, 99, 36,
+ 46, 55,  6, 13, 23,  7, 13, 21, 75, 90,102, 47, 57, 67, 30, 38,
+ 45, 33, 43, 53, 46, 59, 71, 56, 68, 78, 66, 79, 90, 75, 91,104,
+ 80, 99,113, 95,114,127,104,122,135,107,127,140,118,138,152,132,
+151,164,140,159,171,156,174,185,158,176,188,125,138,147, 80, 92,
+102, 88, 99,108, 17, 22, 30, 43, 52, 61, 28, 38, 47, 12, 22, 33,
+ 14, 25, 37, 11, 20, 31, 19, 28, 36,113,131,145,137,157,172,133,
+153,167,141,161,175,144,163,176,152,171,183,155,173,185,145,160,
+171,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+169,184,194,147,166,179,102,113,122, 10, 15, 19, 12, 21, 30, 23,
+ 34, 44, 11, 20, 30,  5, 12, 20,102,117,128,134,150,161,130,149,
+161,129,148,162,135,154,168,133,153,166,131,151,166,132,152,166,
+130,151,165,137,157,171,141,161,175,147,166,179,151,170,182,153,
+171,183,160,177,188,163,180,192,166,183,194,172,188,198,173,189,
+199,183,197,204, 81, 87, 93, 18, 26, 35, 47, 59, 69, 18, 29, 38,
+ 14, 24, 35, 11, 19, 29,  7, 16, 26, 57, 68, 76,138,157,170,138,
+158,172,134,155,169,143,162,176,146,165,179,149,166,179, 75, 96,
+112,128,147,159,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,156,174,184,132,148,158, 33, 41, 50, 10, 17, 26, 24,
+ 34, 45, 26, 39, 50,  7, 15, 24, 36, 43, 49, 59, 63, 66,138,154,
+165,156,174,187,151,170,182,147,166,179,143,162,176,144,162,176,
+144,163,176,144,163,177,149,168,181,151,170,183,151,170,183,157,
+175,186,160,177,189,159,177,189,162,178,190,166,183,193,174,191,
+200,177,193,202,130,142,150, 13, 21, 29, 22, 30, 38, 43, 55, 65,
+ 21, 32, 41, 11, 19, 28, 19, 30, 42, 42, 52, 61,125,145,158,143,
+163,176,135,156,169,136,156,170,141,161,175,140,158,171, 67, 86,
+101,111,134,150,132,153,166,137,156,169,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,179,192,200,132,146,156, 56, 64, 73, 10,
+ 16, 26, 24, 37, 49, 28, 42, 54, 16, 25, 34, 42, 49, 56,117,133,
+143,162,180,192,156,174,186,148,167,179,147,165,178,144,162,175,
+140,159,173,140,159,172,142,161,174,143,161,174,144,162,175,147,
+165,177,146,164,177,150,167,179,144,161,173,145,161,172,148,164,
+175,129,146,159,119,133,145, 45, 57, 67, 35, 46, 55, 49, 62, 72,
+ 42, 55, 67, 20, 31, 43, 19, 30, 41, 24, 33, 41, 49, 63, 73,113,
+133,147,142,162,176,137,157,170,136,157,171,127,146,160, 60, 81,
+ 96,104,127,143,104,128,145,112,135,150,122,143,157,140,158,171,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,188,200,209,121,134,145, 34,
+ 41, 50, 19, 29, 40, 40, 54, 66, 55, 68, 78,123,136,145,136,153,
+164,142,159,170,123,141,154,117,133,145,111,124,133,108,119,128,
+108,121,130,108,121,129,110,122,130,100,113,123, 99,112,121, 88,
+103,114, 76, 91,102, 67, 81, 93, 52, 62, 71, 50, 59, 67, 45, 55,
+ 63, 36, 46, 55, 31, 42, 52, 18, 27, 37, 17, 26, 36, 13, 20, 28,
+ 14, 21, 30,  9, 18, 28,  8, 16, 25,  8, 17, 25,  8, 16, 24, 51,
+ 64, 76,126,146,159,145,165,178,134,155,169,112,130,144, 54, 75,
+ 92,100,123,140, 99,123,139,101,125,141,104,128,144,116,139,154,
+151,169,180,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0, 80, 91,100, 58, 67, 76, 43, 55, 65, 29, 37, 46, 28, 34,
+ 41, 23, 30, 37, 13, 23, 31,  7, 16, 25,  4,  8, 17,  3,  6, 13,
+  3,  8, 15,  3,  9, 16,  3,  7, 14,  2,  6, 12,  3,  6, 10,  4,
+ 12, 21,  5, 13, 21,  9, 19, 29,  7, 16, 25,  6, 16, 27,  7, 16,
+ 26,  7, 14, 24,  6, 14, 24,  9, 18, 27,  7, 15, 23,  5, 12, 20,
+  8, 17, 27,  6, 13, 21,  5, 11, 19,  6, 14, 22,  7, 16, 24,  4,
+ 10, 17, 56, 70, 81,117,133,146,115,132,145, 71, 88,102, 59, 79,
+ 95,101,125,141,101,124,140,100,124,140,102,126,142,105,128,144,
+108,132,147,115,137,153,117,137,152,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0, 46, 53, 59,  9, 14, 21, 18, 31, 42, 10, 20,
+ 30,  6, 14, 24,  6, 15, 24,  7, 15, 25,  7, 16, 27,  6, 14, 22,
+  6, 13, 21,  7, 14, 23,  8, 17, 26,  6, 11, 18,  7, 14, 21,  9,
+ 18, 28,  9, 17, 27, 10, 18, 27,  9, 17, 26, 10, 18, 29,  7, 14,
+ 21,  8, 15, 24, 11, 21, 32, 12, 21, 31, 12, 22, 32, 12, 22, 33,
+ 13, 24, 36, 13, 23, 34, 10, 20, 30, 10, 19, 28, 10, 20, 30, 10,
+ 20, 30, 19, 31, 42, 35, 49, 61, 34, 48, 60, 28, 44, 59, 65, 86,
+102,102,126,142,101,124,141,104,127,143,105,128,145,104,127,143,
+106,129,145,108,131,147,106,128,144,117,137,151,124,143,156,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,159,164,168, 61, 68, 75, 31, 41, 49, 36, 44,
+ 52, 28, 36, 45, 21, 31, 41, 24, 36, 47, 28, 42, 54, 32, 46, 58,
+ 27, 41, 53, 28, 42, 54, 30, 46, 60, 34, 51, 65, 36, 53, 67, 36,
+ 54, 68, 38, 56, 69, 38, 56, 70, 37, 55, 70, 39, 58, 73, 34, 50,
+ 65, 35, 52, 67, 32, 49, 65, 28, 44, 59, 27, 43, 58, 25, 41, 57,
+ 26, 42, 57, 18, 32, 46, 17, 31, 44, 14, 26, 38, 14, 26, 38, 16,
+ 28, 41, 15, 27, 41, 19, 33, 48, 19, 34, 48, 21, 37, 52, 77, 99,
+115,104,128,144,105,128,145,108,131,146,105,128,145,106,129,146,
+108,131,147,107,130,146,107,130,146,101,125,142, 96,119,135,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,158,167,173,111,124,133,150,157,
+162,122,136,146, 89,108,122, 82,102,118, 82,105,121, 69, 92,110,
+ 63, 86,104, 57, 80, 98, 55, 78, 96, 54, 76, 94, 53, 75, 93, 46,
+ 68, 85, 44, 66, 83, 45, 67, 84, 46, 67, 85, 47, 69, 86, 42, 63,
+ 80, 41, 61, 79, 36, 56, 73, 34, 53, 69, 29, 46, 63, 25, 42, 57,
+ 23, 39, 54, 18, 31, 45, 15, 29, 42, 14, 25, 38, 12, 24, 36, 13,
+ 23, 34, 12, 22, 34, 14, 26, 39, 16, 29, 43, 19, 33, 47, 78,100,
+115,108,131,147,107,130,146,109,132,148,107,130,146,109,132,148,
+110,133,148,108,131,147,107,130,146,105,128,144, 93,117,134,103,
+124,139,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,133,152,166,101,125,142, 91,115,132, 85,109,126, 72, 96,114,
+ 69, 91,109, 62, 85,103, 56, 78, 96, 52, 74, 92, 52, 74, 92, 48,
+ 70, 87, 43, 65, 82, 46, 67, 84, 47, 69, 86, 45, 67, 84, 41, 61,
+ 78, 39, 59, 76, 37, 56, 73, 34, 53, 70, 28, 45, 61, 22, 38, 52,
+ 19, 33, 47, 15, 28, 41, 13, 25, 39, 10, 19, 31, 11, 21, 33, 12,
+ 22, 34,  9, 18, 29, 11, 22, 34, 12, 23, 35, 11, 23, 36, 77, 98,
+114,107,131,146,109,132,147,108,131,146,108,131,147,107,130,146,
+110,133,149,109,132,148,106,129,146,103,127,143, 94,118,135,101,
+122,138,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,128,149,163,100,124,140, 84,108,125, 79,103,121, 70, 94,112,
+ 66, 89,107, 61, 84,102, 56, 79, 97, 52, 75, 92, 51, 74, 91, 46,
+ 67, 85, 44, 65, 83, 47, 68, 85, 47, 69, 86, 41, 61, 78, 37, 57,
+ 74, 37, 56, 73, 37, 56, 73, 36, 55, 72, 31, 49, 66, 23, 38, 54,
+ 17, 32, 45, 15, 27, 39, 11, 21, 33, 11, 21, 33, 10, 21, 31,  9,
+ 19, 29,  9, 18, 28, 10, 21, 32, 10, 20, 31, 10, 21, 33, 84,106,
+122,107,131,146,108,131,147,110,133,149,111,134,149,108,131,147,
+110,133,149,108,131,147,104,127,143,101,124,140, 97,120,137, 97,
+119,135,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,125,145,160, 96,120,136, 75, 99,117, 75, 98,116, 65, 88,106,
+ 60, 83,101, 58, 81, 99, 58, 81, 99, 56, 79, 96, 52, 73, 91, 47,
+ 68, 86, 45, 66, 84, 48, 69, 87, 43, 64, 81, 37, 56, 73, 34, 52,
+ 70, 35, 54, 71, 34, 54, 70, 32, 50, 66, 28, 46, 62, 27, 44, 60,
+ 19, 34, 47, 16, 28, 41, 13, 24, 36, 13, 25, 38, 10, 21, 31, 11,
+ 21, 32, 12, 23, 34, 12, 21, 32, 10, 19, 29, 12, 22, 34, 94,117,
+132,110,133,149,109,132,148,111,134,150,112,135,151,110,133,148,
+112,135,151,109,132,148,104,127,143,103,126,143, 98,122,139, 95,
+117,134,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,127,148,162, 95,117,134, 81,103,121, 81,105,123, 74, 98,115,
+ 71, 94,112, 70, 94,111, 67, 91,109, 59, 82,100, 57, 79, 97, 54,
+ 77, 94, 52, 74, 92, 53, 76, 94, 47, 69, 86, 40, 61, 78, 38, 58,
+ 75, 37, 58, 75, 39, 59, 76, 35, 55, 72, 32, 51, 67, 31, 48, 64,
+ 24, 40, 54, 22, 37, 52, 18, 32, 45, 18, 32, 45, 18, 32, 45, 18,
+ 31, 44, 19, 33, 47, 18, 31, 43, 33, 46, 57, 63, 78, 92,112,135,
+150,114,137,152,112,135,151,110,133,149,112,135,151,112,135,151,
+113,135,151,111,134,150,106,129,145,104,127,143, 97,121,138,119,
+140,154,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,136,155,168, 99,121,136, 98,120,136, 96,119,136, 88,112,128,
+ 78,102,119, 76, 99,116, 69, 92,109, 62, 85,102, 61, 83,101, 58,
+ 80, 98, 52, 74, 92, 51, 74, 92, 47, 68, 86, 42, 63, 80, 39, 59,
+ 75, 37, 57, 73, 40, 60, 77, 39, 58, 75, 35, 54, 71, 33, 52, 68,
+ 30, 49, 65, 28, 45, 60, 27, 44, 59, 29, 45, 60, 30, 47, 62, 30,
+ 48, 64, 35, 52, 67, 52, 72, 87, 96,117,133,118,139,154,118,140,
+156,116,139,154,114,137,153,113,136,152,113,136,151,111,134,150,
+109,132,148,109,132,148,107,130,146,104,127,144, 99,123,140,132,
+151,164,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,104,125,139, 70, 91,108, 67, 87,104, 63, 84,101, 62, 84,101,
+ 58, 79, 96, 62, 84,100, 68, 89,106, 76, 98,115, 76, 98,114, 81,
+102,119, 87,109,125, 94,117,133, 92,114,130, 87,109,126, 88,111,
+126, 87,109,125, 90,112,128, 85,107,124, 78,101,117, 73, 96,113,
+ 64, 85,103, 63, 85,103, 63, 86,103, 54, 75, 93, 55, 75, 92, 73,
+ 96,112,100,123,138,114,136,152,119,141,157,120,142,157,116,139,
+154,115,138,153,116,139,154,117,140,155,114,136,152,108,131,147,
+106,129,145,109,131,147,106,129,145,105,128,145,101,126,142,122,
+141,154,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,162,177,188,136,155,
+168,129,148,160,113,132,146,110,128,142,113,131,145,122,140,153,
+129,146,159,136,153,166,140,158,171,143,161,173,143,161,173,144,
+162,174,143,161,173,142,159,170,139,155,167,136,153,165,137,154,
+165,137,154,166,138,156,168,134,153,165,134,153,166,133,152,165,
+128,148,161,120,140,154,109,130,146, 85,109,125,101,123,139,117,
+139,154,122,144,159,121,143,159,120,142,157,120,141,157,117,139,
+154,116,139,154,116,138,154,119,141,157,116,139,154,108,131,147,
+106,129,145,108,130,146,106,130,145,102,126,142, 99,123,139,121,
+140,153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,176,192,204,181,196,206,168,185,196,151,166,
+176,137,149,157,117,132,142, 95,107,117, 89, 96,102, 94,100,105,
+ 94,100,104, 93,100,104, 86, 93, 98, 81, 89, 96, 74, 83, 89, 68,
+ 79, 86, 61, 71, 78, 55, 62, 68, 52, 58, 64, 50, 57, 67, 52, 59,
+ 68, 53, 60, 69, 56, 64, 72, 56, 65, 72, 63, 72, 79, 71, 81, 88,
+ 76, 84, 91, 78, 87, 92, 97,108,116,121,144,159,134,154,169,132,
+153,167,126,147,162,123,144,159,121,144,159,118,140,156,115,137,
+152,113,136,152,115,137,153,117,140,155,117,139,155,113,136,151,
+111,134,150,106,129,145,106,129,145,100,124,140,100,124,141,118,
+137,151,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,137,147,153,111,123,132, 74, 82, 88, 56, 64, 70, 37, 44,
+ 50, 28, 30, 34, 20, 25, 32, 10, 16, 22,  7, 12, 18,  8, 14, 22,
+  9, 15, 23,  7, 12, 18,  7, 12, 18,  7, 13, 21,  7, 13, 21,  5,
+ 12, 19,  4,  9, 16,  3,  9, 15,  4,  8, 13,  6, 11, 20,  5, 11,
+ 18,  6, 11, 18,  2,  6, 12,  2,  6, 11,  2,  5, 10,  6, 11, 18,
+  7, 13, 21,  8, 13, 19, 30, 37, 43,135,156,170,134,154,169,133,
+154,168,129,150,165,126,147,162,122,144,159,120,142,157,117,139,
+155,116,138,154,115,138,153,117,140,155,117,139,155,114,137,152,
+111,134,150,109,132,148,108,131,146,101,125,142,100,124,141,119,
+138,152,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,140,
+151,158, 30, 35, 38, 17, 22, 29,  8, 15, 22,  4, 10, 17,  4,  9,
+ 14,  3,  6, 11,  2,  6, 11,  3,  8, 15,  5, 12, 20,  4, 10, 18,
+  6, 13, 21,  6, 12, 20,  6, 13, 21,  5, 11, 18,  8, 16, 24,  5,
+ 10, 18,  6, 13, 21,  5, 12, 20,  6, 14, 22,  9, 17, 25,  6, 13,
+ 21,  4,  9, 16,  3,  8, 14,  3,  8, 14,  3,  7, 13,  5, 11, 19,
+  6, 13, 21,  6, 14, 23, 15, 23, 31,138,156,169,134,155,170,136,
+156,170,135,155,170,133,153,168,126,147,162,127,149,163,120,141,
+157,120,141,157,119,141,157,119,141,156,117,140,155,115,138,153,
+111,134,149,111,134,150,110,133,148,106,129,145,104,127,144,116,
+136,151,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,104,
+112,117,  5, 12, 20,  5, 11, 19,  4, 10, 18,  3,  8, 13,  5, 11,
+ 18,  4,  9, 15,  4, 10, 17,  3,  9, 16,  5, 11, 18,  3,  7, 13,
+  5, 11, 18,  5, 11, 19,  5, 12, 19,  4,  9, 16,  6, 12, 20,  5,
+ 10, 16,  6, 11, 18,  5, 12, 20,  9, 18, 28, 10, 18, 27,  6, 13,
+ 22,  4, 10, 17,  3,  8, 13,  3,  8, 14,  4,  9, 15,  5, 10, 17,
+ 27, 32, 40, 24, 30, 37, 11, 15, 21,137,154,165,147,167,180,145,
+164,178,141,161,174,138,158,172,132,152,167,126,148,163,122,144,
+159,123,144,158,120,142,158,117,139,155,118,140,156,117,139,155,
+110,133,149,109,132,148,111,134,150,108,131,147,107,130,146,115,
+136,151,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83,
+ 93,100,  4, 12, 21,  5, 12, 19,  4, 10, 17,  5, 12, 20,  3,  8,
+ 14,  3,  7, 12,  4, 11, 18,  5, 13, 21,  5, 12, 18,  4, 10, 16,
+  5, 10, 16,  4,  9, 15,  4,  9, 16,  4,  9, 16,  3,  8, 14,  5,
+ 10, 17,  5, 10, 16,  4,  9, 16,  8, 16, 25,  6, 13, 21,  7, 14,
+ 22,  7, 14, 23,  5, 10, 16,  4,  9, 15,  6, 12, 19,  5, 12, 18,
+ 22, 26, 32, 20, 24, 29, 10, 14, 20,135,153,164,153,172,185,147,
+166,179,142,162,175,140,159,173,133,153,168,128,149,164,125,147,
+162,124,146,160,121,142,158,118,140,156,118,140,155,117,139,154,
+112,134,150,107,130,146,109,132,148,107,130,146,107,130,146,110,
+132,148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 58,
+ 66, 73,  4,  9, 16,  6, 12, 20,  3,  8, 13,  3,  8, 12,  2,  6,
+ 12,  3,  8, 14,  4,  9, 15,  4, 10, 17,  4,  9, 15,  2,  7, 12,
+  4, 10, 17,  6, 13, 20,  6, 13, 21,  6, 13, 21,  6, 12, 21,  8,
+ 18, 27,  6, 13, 23,  6, 14, 22,  7, 14, 23,  7, 13, 21,  7, 14,
+ 22,  6, 14, 23,  8, 15, 24,  6, 11, 20,  5, 11, 17,  6, 12, 20,
+  9, 17, 26,  4, 10, 17, 10, 15, 21,136,153,164,154,172,185,149,
+167,181,148,167,180,145,164,178,136,156,170,129,150,165,124,146,
+161,125,147,162,123,144,159,120,142,158,118,141,156,114,137,152,
+112,135,151,109,132,148,108,131,147,109,132,148,111,134,149,110,
+132,148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,204,211,217, 48,
+ 51, 55,  3,  7, 13,  3,  7, 12,  2,  6, 10,  3,  7, 12,  3,  7,
+ 12,  3,  7, 13,  4,  9, 15,  6, 13, 21,  8, 17, 24,  5, 10, 17,
+  6, 12, 20,  8, 16, 24,  6, 14, 22,  4,  9, 15,  5, 12, 19, 10,
+ 19, 29,  7, 14, 22,  5, 12, 19,  4,  9, 16,  3,  8, 13,  4, 10,
+ 16,  4,  9, 15,  8, 16, 25,  6, 13, 22,  3,  8, 14,  6, 12, 20,
+ 16, 25, 32,  9, 15, 22,  7, 11, 16,133,151,162,154,173,186,151,
+169,182,150,169,182,149,169,181,139,159,173,130,151,166,125,146,
+162,127,148,163,125,146,161,123,144,160,119,141,157,114,137,152,
+112,135,151,109,132,148,108,131,148,109,132,148,109,132,148,106,
+130,145,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,202,208, 37,
+ 42, 46,  3,  8, 12,  3,  7, 13,  3,  8, 14,  3,  8, 14,  3,  7,
+ 11,  5, 10, 17,  5, 11, 18,  5, 12, 18, 11, 22, 32,  8, 15, 25,
+  6, 14, 22,  7, 13, 22,  4, 10, 18,  4, 10, 17,  7, 14, 23,  7,
+ 16, 24,  8, 15, 23,  5, 10, 16,  3,  8, 12,  5, 10, 15,  2,  7,
+ 12,  3,  8, 13,  4, 11, 18,  4, 10, 18,  3,  8, 14,  7, 14, 21,
+ 17, 27, 36,  9, 16, 24,  7, 12, 18,129,147,159,156,175,187,155,
+172,185,152,171,183,152,171,183,139,159,173,129,150,165,124,145,
+161,128,149,164,126,147,162,122,144,159,117,140,155,116,138,154,
+114,137,152,110,133,148,110,133,148,111,134,150,110,134,149,104,
+128,143,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,171,181,189, 20,
+ 27, 33,  5, 11, 18,  3,  9, 14,  2,  6, 12,  2,  6, 11,  3,  7,
+ 12,  3,  8, 14,  4, 10, 16,  4,  9, 15,  8, 17, 23,  9, 18, 26,
+  8, 16, 24,  5, 10, 17,  8, 16, 25, 10, 19, 29,  7, 14, 22,  8,
+ 15, 23,  9, 17, 25,  8, 15, 23,  4,  9, 14,  7, 13, 20,  4,  9,
+ 15,  4,  9, 15,  3,  9, 15,  4, 11, 19,  3,  8, 15,  5, 11, 19,
+  5, 11, 19,  3,  9, 16,  7, 12, 19,130,148,159,161,178,190,158,
+176,188,155,173,185,155,173,185,142,161,175,131,152,167,127,148,
+163,131,152,166,128,149,164,123,145,160,121,143,158,122,143,159,
+115,137,153,112,135,150,111,134,150,112,135,150,110,133,149,103,
+126,142,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,149,156,161,  5,
+  8, 13,  4,  9, 16,  2,  7, 12,  2,  6, 11,  3,  6, 11,  3,  7,
+ 12,  4,  9, 15,  5, 11, 17,  5, 12, 17, 10, 26, 26, 10, 24, 26,
+  6, 11, 20,  7, 15, 25,  9, 19, 26,  8, 18, 27,  7, 14, 24,  9,
+ 18, 27,  8, 16, 24,  6, 13, 21,  4, 10, 17,  5, 10, 17,  4, 10,
+ 17,  3,  9, 15,  3,  9, 15,  3,  9, 15,  2,  7, 11,  5, 11, 18,
+  5, 11, 19,  4,  9, 16,  6, 11, 17,130,147,160,160,178,191,159,
+177,189,156,174,186,153,171,184,143,162,176,133,154,169,131,152,
+166,132,152,167,130,151,166,123,145,160,123,145,160,120,142,158,
+117,139,155,116,138,154,113,135,151,110,133,149,111,134,150,106,
+128,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,137,145,149,  4,
+  8, 13,  3,  8, 14,  2,  6, 11,  3,  7, 12,  3,  8, 12,  5, 10,
+ 15,  5,  9, 16,  4,  9, 15,  5, 12, 18,  6, 16, 18,  7, 17, 20,
+  7, 13, 23,  9, 17, 27, 12, 22, 32,  8, 17, 27,  7, 14, 23,  7,
+ 14, 23,  6, 12, 19,  8, 15, 24,  5, 12, 20,  5, 12, 19,  5, 11,
+ 17,  4,  9, 15,  4, 10, 17,  4,  8, 15,  4, 10, 17,  5, 12, 20,
+  5, 10, 17, 12, 18, 25,  6, 11, 16,131,148,159,164,181,193,162,
+179,191,158,176,188,153,171,183,147,166,179,140,159,174,137,157,
+171,134,154,169,130,152,167,126,147,163,125,146,162,123,144,160,
+117,139,155,118,140,156,115,137,153,111,134,150,111,134,150,106,
+129,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,115,126,134,  4,
+  6, 12,  4,  8, 17,  3,  7, 12,  1,  4,  7,  1,  4,  7,  2,  5,
+  9,  4,  8, 12,  4, 13, 15,  7, 19, 19, 12, 32, 26,  6, 13, 20,
+  9, 18, 28,  7, 16, 25, 12, 23, 34, 10, 19, 30,  8, 16, 25,  8,
+ 16, 26,  4,  8, 14,  6, 13, 20,  6, 13, 22,  6, 14, 22,  5, 12,
+ 20,  4,  9, 16,  4,  9, 15,  5, 11, 17,  7, 14, 22,  5, 12, 21,
+  7, 12, 19, 23, 34, 43,  7, 12, 18,135,152,163,166,183,195,162,
+179,191,158,175,187,152,170,183,148,167,180,146,164,178,139,159,
+173,136,156,171,133,154,168,130,152,167,129,150,166,129,150,165,
+122,144,160,116,139,154,116,138,154,113,136,151,114,137,152,108,
+130,146,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 79, 91,104, 31,
+ 34,102, 10, 13, 36,  4,  9, 14,  2,  5, 10,  1,  4,  7,  6, 12,
+ 19, 11, 20, 28, 10, 24, 27, 10, 24, 27, 11, 39, 22,  5, 13, 20,
+  8, 18, 28,  7, 14, 23,  8, 17, 26,  8, 16, 26,  7, 15, 24,  6,
+ 14, 23,  3,  9, 14,  5, 12, 20,  5, 10, 18,  7, 14, 23,  7, 14,
+ 23,  5, 12, 20,  8, 15, 22,  6, 12, 20,  7, 15, 24,  5, 11, 18,
+  5, 10, 16, 19, 31, 43, 10, 16, 22,138,154,165,167,185,195,163,
+181,192,160,177,189,155,173,185,150,169,181,148,167,180,142,161,
+175,139,160,174,137,157,171,135,156,170,133,153,168,132,153,167,
+124,145,161,119,141,156,118,140,156,120,141,157,115,138,154,106,
+129,145,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 83, 89, 96, 21,
+ 23,109, 10, 13, 47,  3,  8, 12,  2,  4,  9,  3,  6, 11,  7, 14,
+ 20,  8, 15, 21,  7, 13, 19,  6, 13, 18,  5, 13, 17,  4, 10, 16,
+  5, 12, 20,  6, 13, 20,  7, 14, 22,  7, 15, 23,  5, 11, 19,  5,
+ 12, 20,  6, 12, 20,  6, 13, 21,  4,  9, 16,  5, 11, 19,  8, 15,
+ 24,  7, 15, 24,  5, 12, 19,  5, 12, 20,  8, 15, 24,  5, 10, 16,
+ 12, 19, 26, 24, 31, 38, 12, 16, 22,143,159,170,170,186,197,166,
+183,194,161,178,190,158,176,188,153,172,184,150,169,182,145,165,
+178,141,161,174,138,158,172,136,156,170,134,155,169,133,153,168,
+127,148,164,122,144,159,119,141,156,118,140,155,115,137,153,105,
+128,144,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 96, 99,102, 21,
+ 22, 83, 13, 14, 42,  2,  5,  8,  2,  5,  9,  2,  6, 11, 10, 21,
+ 20, 12, 24, 23, 11, 31, 24,  8, 35, 18,  8, 25, 16,  3,  9, 13,
+  6, 13, 21,  7, 14, 22,  5, 11, 17,  6, 13, 21,  6, 13, 20,  8,
+ 18, 24,  5, 11, 18,  5, 11, 19,  3,  9, 16,  5, 12, 19,  6, 12,
+ 20,  5, 11, 19,  6, 12, 19,  5, 11, 17,  8, 16, 25,  5, 10, 16,
+ 17, 22, 28, 32, 40, 49, 11, 16, 21,148,164,173,169,187,197,167,
+184,195,164,181,192,159,177,188,153,171,184,149,167,180,148,167,
+180,144,163,177,140,159,173,137,157,171,134,155,169,134,154,169,
+127,148,162,124,145,160,124,145,160,120,142,157,117,140,155,109,
+132,148,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 91, 95, 98,  7,
+  8, 27,  5,  6, 18,  2,  6, 11,  1,  3,  7,  2,  5,  9,  5, 12,
+ 13,  8, 21, 19, 14, 32, 32,  9, 27, 20,  4, 12, 10,  2,  6, 11,
+  5, 13, 21,  6, 12, 20,  6, 13, 21,  9, 18, 28,  7, 15, 23,  6,
+ 14, 20,  3,  8, 14,  3,  8, 14,  3,  9, 15,  5, 12, 19,  4, 10,
+ 17,  4,  9, 15,  7, 14, 21,  5, 12, 18,  5, 10, 16,  4,  8, 13,
+  9, 15, 21, 31, 47, 61, 12, 17, 23,151,167,176,171,187,197,169,
+185,196,166,183,194,160,178,189,154,173,185,150,168,181,146,165,
+178,143,163,177,142,162,175,137,158,172,133,154,168,134,155,168,
+128,149,164,128,149,164,131,152,166,126,147,162,119,141,157,111,
+133,149,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85, 92, 97,  1,
+  4,  9,  2,  5,  9,  3,  8, 13,  2,  6, 10,  4,  8, 15, 10, 29,
+ 20, 12, 32, 23, 14, 25, 30, 14, 35, 20,  8, 20, 14,  2,  6, 10,
+  6, 13, 20,  4,  9, 16,  7, 13, 21,  7, 15, 24,  8, 16, 25,  4,
+ 10, 16,  4, 11, 18,  3, 10, 16,  4, 10, 17,  6, 12, 20,  5, 11,
+ 18,  7, 15, 23,  7, 14, 22,  5, 11, 18,  2,  6, 11,  3,  8, 14,
+  8, 14, 20, 40, 50, 60, 15, 21, 28,154,169,178,169,186,197,172,
+188,198,166,183,194,160,177,189,152,171,183,150,169,181,146,165,
+179,145,164,177,141,161,175,136,156,170,134,154,168,136,156,170,
+134,155,169,131,152,166,129,150,165,125,146,162,124,145,160,115,
+137,153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 76, 84, 91,  2,
+  5, 10,  4,  9, 14,  3,  7, 12,  2,  7, 11,  4,  8, 14, 11, 28,
+ 22,  9, 31, 16, 12, 39, 20, 17, 46, 26, 11, 30, 23,  4,  9, 15,
+  5, 12, 19,  3,  8, 13,  5, 10, 17,  5, 11, 18,  8, 16, 26,  6,
+ 13, 21,  5, 11, 19,  6, 12, 20,  5, 11, 17,  5, 11, 18,  5, 11,
+ 18,  5, 12, 19,  4, 10, 16,  5, 10, 17,  4,  9, 14,  5, 10, 18,
+  5, 10, 16, 19, 25, 32, 12, 17, 22,153,168,177,169,186,196,172,
+188,198,165,182,193,159,177,189,151,170,183,150,168,181,146,165,
+179,146,165,178,141,161,175,139,158,172,135,155,170,140,160,173,
+135,156,170,132,153,167,129,150,165,127,148,163,125,146,161,115,
+138,153,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65, 74, 81,  1,
+  4,  6,  2,  6, 11,  1,  4,  8,  1,  5,  8,  4,  7, 14, 13, 37,
+ 23, 10, 32, 20, 10, 32, 18, 20, 56, 29, 11, 28, 22,  3,  8, 14,
+  2,  6, 11,  5, 11, 16,  4,  9, 14,  5, 11, 17,  4, 10, 16,  5,
+ 11, 19,  6, 13, 21,  5, 11, 19,  4,  8, 14,  5, 11, 19,  4, 10,
+ 17,  3,  8, 13,  5, 12, 20,  4,  9, 16,  5, 10, 17,  6, 12, 20,
+  5, 11, 19,  4, 10, 17, 15, 21, 27,154,170,181,169,185,196,172,
+188,198,165,182,193,160,177,189,154,173,185,150,169,181,149,168,
+180,147,166,179,144,164,177,140,160,174,138,158,172,138,159,173,
+136,156,170,134,154,168,132,152,167,129,150,164,126,147,162,117,
+138,154,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52, 60, 67,  1,
+  4,  9,  2,  5, 10,  1,  5,  9,  3,  7, 11,  5,  8, 15,  7, 29,
+ 14, 11, 33, 21, 10, 31, 20, 13, 47, 18,  7, 20, 16,  2,  6, 12,
+  4,  9, 14,  5, 10, 16,  3,  7, 13,  6, 11, 18,  6, 13, 21,  7,
+ 14, 22,  5, 12, 19,  6, 13, 22, 10, 19, 29, 11, 21, 32,  5, 11,
+ 18,  4, 10, 16,  6, 14, 22,  6, 13, 20,  6, 14, 23,  4, 10, 17,
+  6, 14, 22,  4,  9, 16, 27, 36, 42,162,179,190,169,185,195,171,
+187,197,164,181,192,160,177,189,156,175,187,150,169,181,150,169,
+181,148,166,179,148,167,180,145,164,178,145,164,178,141,160,174,
+136,156,171,138,158,172,134,155,169,134,154,169,130,151,165,119,
+141,156,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47, 55, 63,  2,
+  6, 12,  2,  6, 11,  2,  5,  9,  2,  4,  7,  4,  9, 15,  7, 12,
+ 22, 11, 22, 26,  9, 29, 19, 12, 42, 18, 10, 28, 20,  4,  9, 16,
+  5, 12, 20,  5, 11, 17,  4,  8, 14,  3,  9, 14,  5, 12, 20,  7,
+ 15, 23,  5, 11, 18,  8, 16, 24,  7, 16, 25,  6, 13, 21,  6, 14,
+ 22,  4, 10, 16,  6, 13, 20,  5, 12, 18,  4, 10, 17,  4, 10, 16,
+  8, 16, 25,  5, 11, 19, 41, 49, 55,169,186,197,170,186,196,168,
+184,195,164,181,192,159,177,188,156,174,186,152,171,183,152,171,
+183,149,168,181,150,169,181,145,164,178,146,164,178,144,163,177,
+137,157,172,137,157,172,138,158,172,133,155,169,130,151,166,117,
+139,154,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41, 48, 54,  4,
+  9, 15,  3,  7, 12,  2,  5, 10,  1,  3,  6,  5, 11, 17, 14, 26,
+ 36, 15, 39, 29,  9, 32, 19, 17, 59, 26,  5, 16, 15,  3,  9, 16,
+  5, 12, 20,  7, 15, 24,  4, 10, 17,  3,  7, 13,  5, 11, 18,  6,
+ 13, 21,  7, 14, 22,  7, 15, 24,  4, 10, 18,  5, 12, 20,  6, 13,
+ 20,  6, 13, 20,  8, 16, 24,  5, 12, 19,  4,  9, 16,  7, 14, 22,
+  6, 13, 20,  4, 10, 19, 56, 62, 68,170,187,199,170,186,197,168,
+184,195,164,181,192,159,178,189,156,175,187,154,172,184,152,171,
+183,149,169,181,151,169,182,146,165,179,143,162,176,140,160,174,
+138,158,172,136,156,171,135,156,170,135,155,170,130,150,165,119,
+141,156,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41, 46, 52,  8,
+ 14, 20,  4, 10, 17,  3,  7, 13,  2,  5, 10,  3,  7, 13,  6, 13,
+ 18,  8, 18, 21, 11, 25, 24, 14, 34, 32,  7, 16, 21,  4, 10, 17,
+  4, 10, 17,  6, 12, 20,  5, 11, 19,  4,  9, 15,  5, 11, 18,  5,
+ 11, 18,  5, 11, 19,  7, 15, 24,  4, 10, 17,  7, 13, 22,  4, 10,
+ 17,  7, 14, 22,  7, 14, 22,  6, 12, 20,  6, 12, 19,  5, 11, 18,
+  5, 12, 21,  4, 10, 17, 63, 68, 73,167,184,195,170,186,196,169,
+185,196,166,183,193,161,178,190,158,176,188,152,170,183,152,171,
+183,150,170,182,150,168,181,146,165,178,142,162,175,139,159,173,
+138,158,172,138,157,172,138,158,171,134,154,169,131,151,166,122,
+143,158,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41, 46, 52, 10,
+ 15, 20,  4,  9, 15,  4,  9, 15,  4,  9, 15,  6, 11, 16,  6, 13,
+ 16,  8, 22, 17, 16, 31, 34, 13, 29, 29, 11, 27, 23,  6, 13, 20,
+  5, 11, 18,  6, 12, 20,  6, 11, 19,  3,  8, 13,  4, 11, 17,  4,
+ 10, 16,  3, 10, 16,  4, 10, 17,  5, 11, 17,  5, 11, 17,  5, 11,
+ 19,  8, 17, 24, 10, 20, 29,  6, 13, 21,  4, 10, 18,  4,  9, 16,
+  7, 15, 23,  5, 10, 16, 67, 73, 76,165,183,194,171,188,197,170,
+186,196,166,182,193,162,179,190,159,177,188,156,174,186,153,171,
+183,148,167,180,149,167,180,145,164,177,143,162,175,138,159,173,
+139,160,173,138,158,172,136,156,171,129,150,164,130,151,165,125,
+146,161,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39, 43, 48,  1,
+  4,  9,  3,  7, 11,  4,  9, 16,  4,  9, 15,  7, 19, 17, 13, 35,
+ 22, 11, 45, 18,  7, 22, 17, 20, 58, 31, 29, 64, 41,  6, 13, 18,
+  5, 12, 19,  5, 10, 18,  4,  9, 16,  3,  7, 12,  4,  9, 15,  5,
+ 11, 18,  3,  8, 14,  6, 12, 20,  5, 12, 19,  7, 14, 21,  5, 11,
+ 18,  7, 16, 23, 10, 20, 29,  8, 16, 24,  8, 16, 26,  6, 13, 21,
+  9, 18, 28,  7, 15, 23, 88, 99,105,168,186,197,173,189,199,170,
+186,197,168,185,195,163,180,191,158,176,187,159,177,189,153,171,
+183,146,165,179,148,167,180,147,166,179,143,162,176,141,160,174,
+140,160,174,138,158,172,133,154,169,130,151,165,128,148,164,120,
+143,158,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 39, 43, 48,  2,
+  6, 11,  5, 10, 16,  3,  7, 13,  2,  6, 11,  6, 19, 14, 13, 33,
+ 24, 10, 43, 12, 11, 36, 16, 21, 56, 28, 20, 48, 31,  6, 12, 20,
+  6, 13, 21,  5, 12, 20,  5, 12, 19,  5, 10, 16,  3,  9, 15,  3,
+  9, 15,  4, 10, 17,  6, 13, 21,  5, 12, 19,  5, 12, 18,  4, 10,
+ 17,  4, 11, 18,  6, 14, 22,  7, 15, 24,  8, 16, 25,  5, 12, 20,
+  6, 13, 22,  6, 12, 21,106,117,125,168,185,196,174,190,200,170,
+186,196,168,185,196,164,181,193,159,178,189,158,176,188,153,172,
+184,147,166,179,149,167,180,147,166,179,145,164,178,144,163,176,
+142,162,175,140,159,174,137,157,172,135,155,169,127,147,163,114,
+137,152,184,195,204,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 41, 49, 55,  5,
+ 10, 17,  6, 13, 19,  3,  6, 11,  2,  6, 10,  8, 15, 22, 12, 29,
+ 26, 10, 35, 18, 13, 46, 18, 19, 58, 29, 13, 31, 26,  6, 12, 19,
+  5, 12, 20,  8, 15, 24,  6, 13, 21,  5, 10, 17,  6, 13, 21,  4,
+ 11, 17,  5, 11, 19,  6, 14, 23,  7, 16, 24,  5, 11, 18,  7, 15,
+ 24,  6, 12, 21,  5, 11, 18,  5, 11, 17,  5, 11, 19,  5, 11, 19,
+  7, 14, 23,  8, 15, 23,117,127,134,164,181,193,174,190,200,170,
+186,196,168,185,196,164,181,192,161,179,190,157,174,186,153,172,
+184,147,166,179,148,166,179,147,165,178,147,166,179,145,164,177,
+141,160,174,138,158,173,136,156,170,133,153,168,127,147,163,118,
+140,155,188,198,207,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43, 52, 60,  4,
+ 11, 18,  5, 12, 20,  3,  7, 12,  2,  5,  9,  6, 13, 19, 13, 27,
+ 32, 13, 31, 32, 13, 53, 22, 13, 38, 27, 10, 23, 27,  6, 13, 21,
+  7, 14, 22,  7, 14, 23,  4, 10, 17,  6, 12, 20,  5, 11, 18,  4,
+ 10, 16,  6, 12, 21,  6, 13, 23,  5, 11, 18,  6, 11, 18,  7, 15,
+ 23,  7, 14, 23,  5, 11, 18,  6, 14, 22,  4, 11, 18,  6, 13, 20,
+  7, 14, 23, 10, 17, 26,120,133,142,163,181,192,173,189,199,170,
+186,196,168,184,195,163,180,192,160,177,189,157,175,187,154,172,
+184,148,167,180,147,166,179,148,167,180,148,167,180,145,164,178,
+143,162,176,136,157,171,134,155,169,131,152,166,126,148,163,117,
+139,155,186,197,205,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 54, 64, 71,  4,
+ 10, 18,  5, 12, 20,  6, 12, 20,  5, 10, 17,  6, 13, 21,  8, 15,
+ 24,  9, 17, 27, 12, 31, 27,  9, 20, 24, 10, 20, 32, 10, 20, 31,
+  6, 14, 23,  7, 15, 23,  7, 15, 24,  8, 16, 26,  7, 15, 24,  8,
+ 21, 23,  9, 17, 25,  8, 17, 28, 10, 19, 28,  7, 13, 21,  7, 14,
+ 22,  7, 14, 22,  6, 14, 23,  7, 15, 24,  5, 11, 18,  6, 13, 20,
+  6, 13, 22, 22, 29, 38,137,153,163,165,182,193,173,189,200,170,
+186,197,167,184,195,164,181,192,161,178,190,157,175,187,153,171,
+183,148,167,180,148,167,180,147,166,179,149,168,181,148,167,180,
+146,165,178,140,160,174,136,156,170,131,151,166,127,148,163,120,
+141,157,188,199,207,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 60, 69, 76,  4,
+ 10, 18,  5, 12, 20,  5, 12, 20,  5, 12, 19,  9, 18, 28,  7, 14,
+ 23,  7, 14, 22,  9, 18, 27,  8, 17, 26, 10, 19, 29,  8, 16, 26,
+  6, 14, 22,  9, 17, 25, 10, 17, 27,  8, 17, 27,  8, 17, 26, 10,
+ 20, 29, 10, 20, 31, 10, 20, 31,  9, 18, 28,  8, 15, 23,  8, 16,
+ 25,  8, 17, 26,  5, 12, 20,  7, 15, 25,  6, 12, 20,  7, 14, 22,
+  6, 13, 22, 29, 34, 40,142,157,167,166,182,193,172,188,199,169,
+185,196,166,183,194,163,180,192,159,177,189,156,174,186,151,170,
+182,149,168,180,150,169,182,149,168,180,149,168,180,147,166,179,
+145,165,177,140,160,174,136,156,170,128,149,164,126,147,163,119,
+141,156,188,200,207,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66, 75, 83,  3,
+  9, 17,  6, 13, 21,  4, 10, 18,  8, 16, 26,  9, 18, 28,  8, 15,
+ 24,  7, 15, 24,  9, 18, 28,  8, 17, 26,  8, 16, 25,  9, 17, 27,
+  7, 14, 23, 10, 19, 28, 13, 21, 31,  8, 14, 22,  4, 10, 18,  6,
+ 14, 23,  8, 16, 25,  8, 16, 26,  6, 13, 21,  6, 13, 20,  8, 16,
+ 26,  7, 14, 23,  7, 13, 23,  6, 13, 23,  7, 15, 24,  6, 14, 21,
+  7, 15, 24, 39, 44, 50,147,162,174,167,184,194,169,185,196,165,
+183,193,163,180,191,162,179,191,157,175,187,157,175,187,149,169,
+181,148,167,180,146,165,178,147,166,179,146,165,178,147,166,180,
+144,163,176,139,159,173,133,154,168,130,151,166,126,147,163,116,
+139,155,190,202,209,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85, 94,101, 16,
+ 23, 31, 12, 16, 21,  9, 12, 19,  8, 12, 19,  6, 13, 21,  6, 13,
+ 21,  7, 15, 24,  8, 17, 27,  7, 14, 23,  6, 14, 23,  9, 19, 29,
+  5, 13, 22, 19, 29, 39, 41, 57, 72, 18, 28, 36,  4, 11, 19,  6,
+ 13, 22,  8, 16, 26, 10, 19, 30,  6, 13, 22,  5, 12, 20,  8, 16,
+ 25,  5, 12, 19,  7, 14, 23,  6, 13, 22,  7, 15, 25,  8, 15, 24,
+ 10, 16, 26, 64, 73, 81,150,168,181,168,185,195,165,182,193,163,
+181,192,162,179,191,160,177,188,157,174,187,155,173,185,149,169,
+182,148,167,180,143,162,176,145,164,178,145,165,178,142,162,176,
+139,159,173,134,154,169,133,153,167,123,144,159,126,147,163,145,
+163,176,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,165,177,184,145,
+158,167,120,131,140,102,110,116, 86, 95,102, 65, 75, 83, 47, 54,
+ 61, 43, 52, 60, 37, 47, 55, 31, 40, 49, 26, 33, 41, 23, 30, 39,
+ 21, 29, 39, 24, 30, 38, 29, 34, 39, 24, 28, 35, 20, 26, 34, 22,
+ 31, 40, 22, 32, 42, 21, 28, 38, 22, 31, 40, 27, 35, 44, 32, 41,
+ 51, 36, 44, 52, 41, 48, 55, 46, 54, 62, 60, 74, 86, 78, 90, 99,
+ 90,101,110,139,154,165,160,177,189,172,188,198,169,186,196,168,
+184,195,167,183,194,165,182,193,160,177,189,158,175,187,154,172,
+185,154,172,184,152,171,183,156,174,186,154,172,185,152,171,183,
+139,159,173,160,177,188,183,195,204,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,200,
+211,217,198,209,216,195,206,213,186,199,206,173,185,193,158,167,
+173,139,152,161,123,138,147,105,121,131, 88,101,111,130,141,149,
+132,141,147,130,137,141,130,136,140,132,137,142,129,137,142,132,
+141,147,129,139,146,128,137,144,131,142,149,138,152,161,147,160,
+170,159,171,179,167,178,185,173,183,191,175,188,197,182,195,204,
+183,197,205,182,196,206,182,196,205,182,196,205,183,197,206,184,
+198,207,181,195,204,185,198,207,165,181,193,161,178,190,163,180,
+191,168,184,195,177,191,200,181,194,203,178,191,201,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+255,255,241,255,255,255,255,255,255,224,  0,255,255,255,255,240,
+  0,  0,  0, 63,255,255,224,  0,  0,  0,  0, 15,255,255,192,  0,
+  0,  0,  0,  3,255,255,192,  0,  0,  0,  0,  0,255,255,192,  0,
+  0,  0,  0,  0,255,255,224,  0,  0,  0,  0,  0,127,255,240,  0,
+  0,  0,  0,  0,127,255,248,  0,  0,  0,  0,  0,127,255,252,  0,
+  0,  0,  0,  0, 63,255,254,  0,  0,  0,  0,  0, 15,255,255,  0,
+  0,  0,  0,  0,  3,255,255,128,  0,  0,  0,  0,  1,255,255,240,
+  0,  0,  0,  0,  0,127,255,248,  0,  0,  0,  0,  0, 31,255,248,
+  0,  0,  0,  0,  0, 31,255,252,  0,  0,  0,  0,  0, 15,255,255,
+128,  0,  0,  0,  0, 15,255,255,128,  0,  0,  0,  0, 15,255,255,
+128,  0,  0,  0,  0, 15,255,255,128,  0,  0,  0,  0, 15,255,255,
+128,  0,  0,  0,  0, 15,255,255,128,  0,  0,  0,  0, 15,255,254,
+  0,  0,  0,  0,  0, 15,255,248,  0,  0,  0,  0,  0, 15,255,240,
+  0,  0,  0,  0,  0, 15,255,224,  0,  0,  0,  0,  0, 15,255,224,
+  0,  0,  0,  0,  0, 15,255,224,  0,  0,  0,  0,  0, 15,255,224,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0, 15,255,192,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0, 15,255,192,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0, 15,255,192,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0, 15,255,192,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0, 15,255,192,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0, 15,255,192,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0, 15,255,192,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0, 15,255,192,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0, 15,255,192,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0, 15,255,192,
+  0,  0,  0,  0,  0,  7,255,192,  0,  0,  0,  0,  0,  7,255,192,
+  0,  0,  0,  0,  0,  7,255,192,  0,  0,  0,  0,  0,  7,255,192,
+  0,  0,  0,  0,  0,  7,255,192,  0,  0,  0,  0,  0,  7,255,192,
+  0,  0,  0,  0,  0, 15,255,192,  0,  0,  0,  0,  0,127,255,224,
+  0,  0,  0,  0,  7,255,255,255,255,255,255,255,255,255,255,255,
+255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+};
+unsigned favicon_size = sizeof(favicon);
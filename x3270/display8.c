@@ -1025,6 +1025,43 @@ static d8_t d8[] = {
 };
 #define ND8	(sizeof(d8)/sizeof(d8_t))
 
+/*
+ * Inverse (Unicode to display position) maps for the d8 tables, built the
+ * first time a character set is selected. Each is indexed by the high byte
+ * of a BMP code point, and points to a 256-entry page indexed by the low
+ * byte, or is NULL if nothing in that page is displayable. Entries hold the
+ * display position plus 1, so 0 means no mapping.
+ */
+static unsigned short *d8_inv[ND8][256];
+static bool d8_inv_built[ND8];
+
+/* Build the inverse map for one d8 table. */
+static void
+display8_build_inv(int d8_ix)
+{
+    int i;
+
+    for (i = 0; i < 256; i++) {
+	ucs4_t u = d8[d8_ix].u[i];
+	unsigned short *page;
+
+	if (u > 0xffff) {
+	    continue;
+	}
+	page = d8_inv[d8_ix][u >> 8];
+	if (page == NULL) {
+	    page = d8_inv[d8_ix][u >> 8] =
+		(unsigned short *)Calloc(256, sizeof(unsigned short));
+	}
+
+	/* The lowest position wins, as it did with a linear search. */
+	if (!page[u & 0xff]) {
+	    page[u & 0xff] = i + 1;
+	}
+    }
+    d8_inv_built[d8_ix] = true;
+}
+
 /*
  * Initialize or re-initialize the 8-bit display character set.
  * Returns an index into the d8 table, or -1 for failure.
@@ -1036,6 +1073,9 @@ display8_init(char *cset)
 
     for (i = 0; d8[i].cset; i++) {
 	if (!strcasecmp(cset, d8[i].cset)) {
+	    if (!d8_inv_built[i]) {
+		display8_build_inv(i);
+	    }
 	    return i;
 	}
     }
@@ -1052,7 +1092,7 @@ display8_init(char *cset)
 int
 display8_lookup(int d8_ix, ucs4_t ucs4)
 {
-    int i;
+    unsigned short *page;
 
     /* Handle errors. */
     if (d8_ix < 0) {
@@ -1080,10 +1120,13 @@ display8_lookup(int d8_ix, ucs4_t ucs4)
     }
 
     /* Check for a match in the proper table. */
-    for (i = 0; i < 256; i++) {
-	if (d8[d8_ix].u[i] == ucs4) {
-	    return i;
-	}
+    if (!d8_inv_built[d8_ix]) {
+	display8_build_inv(d8_ix);
+    }
+    if (ucs4 <= 0xffff &&
+	    (page = d8_inv[d8_ix][ucs4 >> 8]) != NULL &&
+	    page[ucs4 & 0xff]) {
+	return page[ucs4 & 0xff] - 1;
     }
 
     /* Handle the private-use values for FM and DUP. */
@@ -327,6 +327,8 @@ XtResource xresources[] = {
       boffset(bsd_tm), XtRString, ResFalse },
     { ResTraceMonitor, ClsTraceMonitor, XtRBoolean, sizeof(Boolean),
       boffset(trace_monitor), XtRString, ResTrue },
+    { ResTraceBinary, ClsTraceBinary, XtRBoolean, sizeof(Boolean),
+      boffset(trace_binary), XtRString, ResFalse },
     { ResIdleCommandEnabled, ClsIdleCommandEnabled, XtRBoolean, sizeof(Boolean),
       boffset(idle_command_enabled), XtRString, ResFalse },
     { ResNvtMode, ClsNvtMode, XtRBoolean, sizeof(Boolean),
@@ -1990,6 +1990,16 @@ screen_disp(bool erasing)
     if (screen_changed) {
 	bool was_on = false;
 	bool xwo = false;
+	int first_row, last_row;
+
+	/*
+	 * In 3270 mode, the controller tracks changes by row only. Narrow
+	 * the region to the rows that changed.
+	 */
+	if (ctlr_changed_rows(&first_row, &last_row) && first_changed < 0) {
+	    first_changed = first_row * COLS;
+	    last_changed = (last_row + 1) * COLS;
+	}
 
 	/* Draw the new screen image into "temp_image" */
 	if (erasing) {
@@ -2025,6 +2035,7 @@ screen_disp(bool erasing)
 	screen_changed = false;
 	first_changed = -1;
 	last_changed = -1;
+	ctlr_changed_rows_reset();
     }
 
     if (!xappres.active_icon || !iconic) {
@@ -2761,6 +2772,16 @@ screen_scroll(unsigned char fg, unsigned char bg)
     }
 }
 
+/*
+ * screen_scroll() copies the window contents, so they must be up to date
+ * first.
+ */
+bool
+screen_scroll_needs_sync(void)
+{
+    return true;
+}
+
 /*
  * Toggle mono-/dual-case mode.
  */
@@ -186,6 +186,7 @@ XrmOptionDescRec base_options[]= {
     { OptScriptPort,	DotScriptPort,	XrmoptionSepArg,	NULL },
     { OptScriptPortOnce,DotScriptPortOnce,XrmoptionNoArg,	ResTrue },
     { OptTermName,	DotTermName,	XrmoptionSepArg,	NULL },
+    { OptTraceBinary,	DotTraceBinary,	XrmoptionNoArg,		ResTrue },
     { OptTraceFile,	DotTraceFile,	XrmoptionSepArg,	NULL },
     { OptTraceFileSize,	DotTraceFileSize,XrmoptionSepArg,	NULL },
     { OptInputMethod,	DotInputMethod,	XrmoptionSepArg,	NULL },
@@ -268,6 +269,7 @@ static struct option_help {
     { OptSecure, NULL, "Set secure mode" },
     { OptTermName, "<name>", "Send <name> as TELNET terminal name" },
     { OptTrace, NULL, "Enable tracing" },
+    { OptTraceBinary, NULL, "Write traces in binary format" },
     { OptTraceFile, "<file>", "Write traces to <file>" },
     { OptTraceFileSize, "<n>[KM]", "Limit trace file to <n> bytes" },
     { OptInputMethod, "<name>", "Multi-byte input method" },
@@ -868,6 +870,7 @@ main(int argc, char *argv[])
 	    XtAppProcessEvent(appcontext, XtIMXEvent | XtIMTimer);
 	}
 	screen_disp(false);
+	trace_flush();
 	XtAppProcessEvent(appcontext, XtIMAll);
 
 	/* Poll for exited children. */
@@ -1308,6 +1311,7 @@ copy_xres_to_res_bool(void)
     copy_bool(highlight_bold);
     copy_bool(bsd_tm);
     copy_bool(trace_monitor);
+    copy_bool(trace_binary);
     copy_bool(idle_command_enabled);
     copy_bool(nvt_mode);
     copy_bool(script_port_once);
@@ -102,6 +102,7 @@ typedef struct {
 	Boolean highlight_bold;
 	Boolean bsd_tm;
 	Boolean trace_monitor;
+	Boolean trace_binary;
 	Boolean idle_command_enabled;
 	Boolean nvt_mode;
 	Boolean script_port_once;